@@ -48,6 +48,10 @@ constexpr bool kOled2NoPullupsProtoFallback = false;  // enable only for early p
 // Primary SW I2C speed for OLED2 (prototype best-effort). Retry logic remains
 // in the driver if a slower fallback is needed.
 constexpr uint32_t kI2c2FrequencyHz = 100000;
+// Stream OLED frames from a dedicated task (double-buffered) instead of
+// blocking the main loop on each transfer. false = inline sends, the
+// baseline for the per-tick blocked-time counters.
+constexpr bool kDisplayTaskEnabled = true;
 
 constexpr bool kUiSelfTestEnabled = false;
 constexpr uint16_t kUiSelfTestPeriodMs = 700;
@@ -5,8 +5,8 @@
 #include "user_sensors/user_sensors.h"
 
 namespace {
-bool fetch(const DataStore& store, SignalId id, uint32_t now_ms, float& out) {
-  const SignalRead r = store.get(id, now_ms);
+bool fetch(const SignalSnapshot& snap, SignalId id, float& out) {
+  const SignalRead r = snap.get(id);
   if (!r.valid) return false;
   out = r.value;
   return true;
@@ -133,7 +133,7 @@ void AlertsEngine::resetAlert(AlertState& st) {
   st.timer_ms = 0;
 }
 
-void AlertsEngine::evalOilP(const AppState& state, const DataStore& store,
+void AlertsEngine::evalOilP(const AppState& state, const SignalSnapshot& snap,
                             uint32_t now_ms) {
   const bool preset_ok =
       (state.user_sensor[0].preset == UserSensorPreset::kOilPressure) &&
@@ -149,10 +149,10 @@ void AlertsEngine::evalOilP(const AppState& state, const DataStore& store,
   }
   float oilp = 0.0f;
   const bool ready_oil =
-      state.can_ready && fetch(store, sourceToSignal(state.user_sensor[0].source),
-                               now_ms, oilp);
+      state.can_ready &&
+      fetch(snap, sourceToSignal(state.user_sensor[0].source), oilp);
   float rpm = 0.0f;
-  bool rpm_ok = fetch(store, SignalId::kRpm, now_ms, rpm);
+  bool rpm_ok = fetch(snap, SignalId::kRpm, rpm);
   float warn_on = 0.0065f * rpm + 10.0f;
   float warn_off = 0.0065f * rpm + 15.0f;
   float crit_on = 0.0065f * rpm + 5.0f;
@@ -167,7 +167,7 @@ void AlertsEngine::evalOilP(const AppState& state, const DataStore& store,
        crit_on, crit_off, 300, true, now_ms, Direction::kLow);
 }
 
-void AlertsEngine::evalOilT(const AppState& state, const DataStore& store,
+void AlertsEngine::evalOilT(const AppState& state, const SignalSnapshot& snap,
                             uint32_t now_ms) {
   const bool preset_ok =
       (state.user_sensor[1].preset == UserSensorPreset::kOilTemp) &&
@@ -183,8 +183,7 @@ void AlertsEngine::evalOilT(const AppState& state, const DataStore& store,
   }
   float oilt = 0.0f;
   const bool ready = state.can_ready &&
-                     fetch(store, sourceToSignal(state.user_sensor[1].source),
-                           now_ms, oilt);
+                     fetch(snap, sourceToSignal(state.user_sensor[1].source), oilt);
   float warn_on = 130.0f;
   float warn_off = 125.0f;
   float crit_on = 140.0f;
@@ -199,7 +198,7 @@ void AlertsEngine::evalOilT(const AppState& state, const DataStore& store,
        false, now_ms, Direction::kHigh);
 }
 
-void AlertsEngine::evalBatt(const AppState& state, const DataStore& store,
+void AlertsEngine::evalBatt(const AppState& state, const SignalSnapshot& snap,
                             uint32_t now_ms) {
   const int8_t idx = pageIndexFor(PageId::kBatt);
   const bool min_enabled =
@@ -208,8 +207,8 @@ void AlertsEngine::evalBatt(const AppState& state, const DataStore& store,
       (idx >= 0) && GetPageMaxAlertEnabled(state, static_cast<uint8_t>(idx));
   float batt = 0.0f;
   float rpm = 0.0f;
-  const bool ready = state.can_ready && fetch(store, SignalId::kBatt, now_ms, batt) &&
-                     fetch(store, SignalId::kRpm, now_ms, rpm) && rpm > 800.0f;
+  const bool ready = state.can_ready && fetch(snap, SignalId::kBatt, batt) &&
+                     fetch(snap, SignalId::kRpm, rpm) && rpm > 800.0f;
   Thresholds thr = thresholdsFor(state, PageId::kBatt);
   const bool have_min = min_enabled && !std::isnan(thr.min);
   const bool have_max = max_enabled && !std::isnan(thr.max);
@@ -254,7 +253,7 @@ void AlertsEngine::evalBatt(const AppState& state, const DataStore& store,
   }
 }
 
-void AlertsEngine::evalKnk(const AppState& state, const DataStore& store,
+void AlertsEngine::evalKnk(const AppState& state, const SignalSnapshot& snap,
                            uint32_t now_ms) {
   const int8_t idx = pageIndexFor(PageId::kKnk);
   const bool max_enabled =
@@ -266,7 +265,7 @@ void AlertsEngine::evalKnk(const AppState& state, const DataStore& store,
     return;
   }
   float knk = 0.0f;
-  const bool ready = state.can_ready && fetch(store, SignalId::kKnkRetard, now_ms, knk);
+  const bool ready = state.can_ready && fetch(snap, SignalId::kKnkRetard, knk);
   float warn_on = 3.0f;
   float warn_off = 2.0f;
   float crit_on = 6.0f;
@@ -281,8 +280,34 @@ void AlertsEngine::evalKnk(const AppState& state, const DataStore& store,
        now_ms, Direction::kHigh);
 }
 
+SignalMask AlertsEngine::inputMask(const AppState& state) const {
+  SignalMask mask = SignalBit(SignalId::kRpm) | SignalBit(SignalId::kBatt) |
+                    SignalBit(SignalId::kKnkRetard) |
+                    SignalBit(sourceToSignal(state.user_sensor[0].source)) |
+                    SignalBit(sourceToSignal(state.user_sensor[1].source));
+  size_t count = 0;
+  const PageDef* pages = GetPageTable(count);
+  const size_t n = (count < kPageCount) ? count : kPageCount;
+  for (size_t i = 0; i < n; ++i) {
+    const uint8_t idx = static_cast<uint8_t>(i);
+    if (!GetPageMinAlertEnabled(state, idx) && !GetPageMaxAlertEnabled(state, idx)) {
+      continue;
+    }
+    SignalId sig;
+    if (PageSourceSignal(pages[i].id, state, sig)) {
+      mask |= SignalBit(sig);
+    }
+  }
+  return mask;
+}
+
 void AlertsEngine::update(const AppState& state, const DataStore& store,
                           uint32_t now_ms) {
+  SignalSnapshot snap;
+  store.snapshot(kAllSignalsMask, snap, now_ms);
+  // Thresholds act on the decoded values: smoothing filters are for display
+  // and must not delay an alert.
+  for (SignalRead& r : snap.read) r.value = r.raw;
   for (size_t i = 0; i < kPageCount; ++i) {
     page_level_[i] = AlertLevel::kNone;
   }
@@ -304,7 +329,7 @@ void AlertsEngine::update(const AppState& state, const DataStore& store,
     if (!PageCanonicalValue(
             pages[i].id, state,
             DisplayConfigForDisplay(state, PhysicalDisplayId::kPrimary),
-            store, now_ms, canon)) {
+            snap, now_ms, canon)) {
       continue;
     }
     const bool low = !std::isnan(thr.min) && canon < thr.min;
@@ -314,10 +339,10 @@ void AlertsEngine::update(const AppState& state, const DataStore& store,
     }
   }
   has_crit_ = false;
-  evalOilP(state, store, now_ms);
-  evalOilT(state, store, now_ms);
-  evalBatt(state, store, now_ms);
-  evalKnk(state, store, now_ms);
+  evalOilP(state, snap, now_ms);
+  evalOilT(state, snap, now_ms);
+  evalBatt(state, snap, now_ms);
+  evalKnk(state, snap, now_ms);
   auto mergeLevel = [&](PageId pid, AlertLevel lvl) {
     int8_t idx = pageIndexFor(pid);
     if (idx >= 0 && idx < static_cast<int8_t>(kPageCount)) {
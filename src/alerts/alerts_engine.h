@@ -13,6 +13,8 @@ class AlertsEngine {
   AlertsEngine();
 
   void update(const AppState& state, const DataStore& store, uint32_t now_ms);
+  // Signals whose changes can move an alert (for change subscriptions).
+  SignalMask inputMask(const AppState& state) const;
   AlertLevel alertForPage(PageId page) const;
   bool hasCritical() const { return has_crit_; }
 
@@ -33,10 +35,10 @@ class AlertsEngine {
   AlertLevel page_level_[kPageCount];
   bool has_crit_;
 
-  void evalOilP(const AppState& state, const DataStore& store, uint32_t now_ms);
-  void evalOilT(const AppState& state, const DataStore& store, uint32_t now_ms);
-  void evalBatt(const AppState& state, const DataStore& store, uint32_t now_ms);
-  void evalKnk(const AppState& state, const DataStore& store, uint32_t now_ms);
+  void evalOilP(const AppState& state, const SignalSnapshot& snap, uint32_t now_ms);
+  void evalOilT(const AppState& state, const SignalSnapshot& snap, uint32_t now_ms);
+  void evalBatt(const AppState& state, const SignalSnapshot& snap, uint32_t now_ms);
+  void evalKnk(const AppState& state, const SignalSnapshot& snap, uint32_t now_ms);
   void step(AlertState& st, bool armed, float val, float warn_on, float warn_off,
             uint32_t warn_delay, float crit_on, float crit_off,
             uint32_t crit_delay, bool latch_crit, uint32_t now_ms,
@@ -18,13 +18,16 @@
 #include "config/factory_config.h"
 #include "config/logging.h"
 #include "data/datastore.h"
+#include "data/signal_registry.h"
 #include "drivers/oled_u8g2.h"
 #include "ecu/ecu_manager.h"
 #include "app/can_runtime.h"
 #include "app/input_runtime.h"
 #include "app/button_task.h"
 #include "app/display_init.h"
+#include "app/display_task.h"
 #include "app/can_bootstrap.h"
+#include "app/warm_start.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/queue.h"
 #include "freertos/task.h"
@@ -44,6 +47,7 @@
 #include "ui/pages.h"
 #include "ui/edit_mode_helpers.h"
 #include "wifi/wifi_portal.h"
+#include "wifi/wifi_portal_sse.h"
 #include "wifi/wifi_diag.h"
 
 void applySelfTestStep(AppState& state, uint8_t step);
@@ -90,6 +94,38 @@ void AppSetup() {
   LOGI("ECU profile active: %s (ecu_type=%s)\r\n",
        g_ecu_mgr.activeName(),
        (g_state.ecu_type[0] != '\0') ? g_state.ecu_type : "(none)");
+  {
+    // Profile channels must be known before the stores are sized and before
+    // the CAN task starts; the registry is read-only afterwards.
+    SignalRegistry& registry = SignalRegistry::instance();
+    registry.reset();
+    g_ecu_mgr.profile().declareSignals(registry);
+    const size_t signal_count = registry.count();
+    if (!g_datastore_can.resize(signal_count) ||
+        !g_datastore_demo.resize(signal_count)) {
+      LOGE("DataStore alloc failed for %u signals\r\n",
+           static_cast<unsigned>(signal_count));
+    }
+    LOGI("Signals: %u (%u from profile)\r\n", static_cast<unsigned>(signal_count),
+         static_cast<unsigned>(signal_count - kSignalCount));
+    // ~1.3 s at the 50 Hz dash rate: enough for the wizard blip window.
+    g_history_can.track(SignalId::kRpm, 64, 1.0f);
+    g_history_can.track(SignalId::kMap, 64, 0.1f);
+    g_datastore_can.attachHistory(&g_history_can);
+    // 10 s window on MAP (peak boost); extrema run on every built-in signal.
+    g_aggregates_can.trackWindow(SignalId::kMap, 10000, 0.1f);
+    g_aggregates_demo.trackWindow(SignalId::kMap, 10000, 0.1f);
+    g_datastore_can.attachAggregates(&g_aggregates_can);
+    g_datastore_demo.attachAggregates(&g_aggregates_demo);
+    g_datastore_can.attachHealth(&g_health_can);
+    g_datastore_can.attachFilters(&g_filters_can);
+    g_datastore_demo.attachFilters(&g_filters_demo);
+    g_datastore_can.attachDerived(&g_derived_can);
+    g_datastore_demo.attachDerived(&g_derived_demo);
+    LOGI("Signal history: %u/%u bytes\r\n",
+         static_cast<unsigned>(g_history_can.bytesUsed()),
+         static_cast<unsigned>(SignalHistory::kBudgetBytes));
+  }
 
   StartButtonTask();
 
@@ -168,13 +204,16 @@ void AppSetup() {
       UserSensorCfg us[2] = {g_state.user_sensor[0], g_state.user_sensor[1]};
       float stoich = g_state.stoich_afr;
       bool show_lambda = g_state.afr_show_lambda;
-      if (g_nvs.loadUserSensors(us, stoich, show_lambda)) {
+      if (g_nvs.loadUserSensors(us, stoich, show_lambda, g_state.signal_filter)) {
         g_state.user_sensor[0] = us[0];
         g_state.user_sensor[1] = us[1];
         g_state.stoich_afr = stoich;
         g_state.afr_show_lambda = show_lambda;
       }
     }
+    ApplySignalFilters();
+    g_nvs.loadDerivedChannels(g_state.derived);
+    ApplyDerivedChannels();
     // Legacy compatibility: mirror user sensors into OilConfig for migration only.
     g_state.oil_cfg.swap =
         (g_state.user_sensor[0].source == UserSensorSource::kSensor2) &&
@@ -221,7 +260,7 @@ void AppSetup() {
     if (ui_p.has_page_hidden) {
       g_state.page_hidden_mask = ui_p.page_hidden_mask;
     } else {
-      g_state.page_hidden_mask = 0;
+      g_state.page_hidden_mask.clear();
     }
     EnsureVisiblePages(g_state);
     LOGI(
@@ -264,16 +303,15 @@ void AppSetup() {
       (void)zoneActive;
     }
     if (!ui_p.has_page_units) {
-      g_state.page_units_mask = PageMaskAll(kPageCount) &
-                                0;  // defaults metric
+      g_state.page_units_mask.clear();  // defaults metric
       markUiDirty(millis());
     }
     if (ui_p.has_alert_masks) {
       g_state.page_alert_max_mask = ui_p.page_alert_max_mask;
       g_state.page_alert_min_mask = ui_p.page_alert_min_mask;
     } else {
-      g_state.page_alert_max_mask = 0;
-      g_state.page_alert_min_mask = 0;
+      g_state.page_alert_max_mask.clear();
+      g_state.page_alert_min_mask.clear();
       markUiDirty(millis());
     }
   }
@@ -539,13 +577,18 @@ void AppSetup() {
     // Migration: if no per-page units persisted but legacy screen units were set,
     // seed all pages from units0 once.
     if (!ui_p.has_page_units && (ui_p.units0 || ui_p.units1)) {
-      const uint32_t all_pages_mask = PageMaskAll(kPageCount);
-      g_state.page_units_mask = ui_p.units0 ? all_pages_mask : 0;
+      g_state.page_units_mask =
+          ui_p.units0 ? PageMask::All(kPageCount) : PageMask();
       markUiDirty(millis());
     }
   }
   showSoarerProgress(g_oled_primary, 100);
 
+  // After a reset mid-drive: previous readings (stale), pages and bitrate.
+  const bool warm_start = !cfg_pending && !g_state.demo_mode &&
+                          AppConfig::IsRealCanEnabled() &&
+                          WarmStartRestore(g_state, g_datastore_can, millis());
+
   if (AppConfig::IsRealCanEnabled()) {
     if (g_state.can_bitrate_locked) {
       if (!g_twai.isStarted()) {
@@ -581,12 +624,15 @@ void AppSetup() {
     LOGI("CAN mock mode (real CAN disabled)\r\n");
   }
 
+  // A warm start goes straight to the gauges.
   const uint32_t elapsed_boot = millis() - boot_start_ms;
-  if (elapsed_boot < 2000) {
+  if (!warm_start && elapsed_boot < 2000) {
     delay(2000 - elapsed_boot);
   }
 
-  playHelloSequence(g_oled_primary);
+  if (!warm_start) {
+    playHelloSequence(g_oled_primary);
+  }
   flushButtonQueue();
   g_state.force_redraw[0] = true;
   g_state.force_redraw[1] = true;
@@ -598,4 +644,8 @@ void AppSetup() {
     applySelfTestStep(g_state, g_state.self_test.step);
   }
   StartCanRxTask();
+  StartDisplayTask();
+  AppLoopInitWakeups();
+  WifiPortalSseInit();
+  InitBaroAuto();
 }
@@ -7,6 +7,11 @@
 #include "can_link/twai_link.h"
 #include "ms3_decode/ms3_decode.h"
 #include "data/datastore.h"
+#include "data/derived_channels.h"
+#include "data/signal_aggregates.h"
+#include "data/signal_filter.h"
+#include "data/signal_health.h"
+#include "data/signal_history.h"
 #include "settings/nvs_store.h"
 #include "freertos/portmacro.h"
 #if defined(CONFIG_IDF_TARGET_ESP32C3)
@@ -32,11 +37,26 @@ extern TwaiLink g_twai;
 extern Ms3Decoder g_decoder;
 extern DataStore g_datastore_can;
 extern DataStore g_datastore_demo;
+extern SignalHistory g_history_can;
+extern SignalAggregates g_aggregates_can;
+extern SignalAggregates g_aggregates_demo;
+extern SignalHealth g_health_can;
+extern SignalFilters g_filters_can;
+extern SignalFilters g_filters_demo;
+extern DerivedChannels g_derived_can;
+extern DerivedChannels g_derived_demo;
 extern volatile uint32_t g_can_rx_edge_count;
 extern portMUX_TYPE g_state_mux;
 extern uint8_t g_wire_sda_pin;
 extern uint8_t g_wire_scl_pin;
 DataStore& ActiveStore();
+// Restarts the streaming extrema behind page_recorded_min/max (both stores).
+void ResetSignalExtrema(bool reset_min, bool reset_max);
+// Pushes g_state.signal_filter to both stores (adopted at their next sample).
+void ApplySignalFilters();
+// Compiles g_state.derived for both stores; false (nothing changed) when an
+// expression does not compile.
+bool ApplyDerivedChannels();
 extern NvsStore g_nvs;
 #if SETUP_WIZARD_ENABLED
 extern SetupWizard g_setup_wizard;
@@ -15,11 +15,15 @@
 #include "app/can_bootstrap.h"
 #include "app/can_runtime.h"
 #include "app/display_init.h"
+#include "app/display_task.h"
 #include "app/input_runtime.h"
 #include "app/persist_runtime.h"
+#include "app/warm_start.h"
 #include "config/factory_config.h"
 #include "config/logging.h"
 #include "data/datastore.h"
+#include "data/signal_aggregates.h"
+#include "data/signal_contract.h"
 #include "drivers/oled_u8g2.h"
 #include "freertos/portmacro.h"
 #include "pins.h"
@@ -43,6 +47,9 @@ extern uint8_t g_i2c_scan_attempts;
 extern uint32_t g_last_i2c_scan_ms;
 
 static bool ProbeOled1Ack() {
+  // Wire is shared with the display task's frame transfers (recursive lock,
+  // so callers already holding it are fine).
+  OledU8g2::IoLock io_lock(g_oled_primary);
   if (g_wire_sda_pin != Pins::kI2cSda || g_wire_scl_pin != Pins::kI2cScl) {
     LOGW("Wire not on OLED1 bus, rebinding\r\n");
     Wire.begin(Pins::kI2cSda, Pins::kI2cScl);
@@ -199,24 +206,123 @@ static void MaybeTriggerUnlockedRescan(AppState& state, uint32_t now_ms) {
   }
 }
 
-static void updateRecordedExtrema(AppState& state, const DataStore& store,
-                                  uint32_t now_ms) {
+// Recorded page extrema follow the store's streaming aggregates: only pages
+// whose source signal saw a new min/max since the last tick are touched.
+static void updateRecordedExtrema(AppState& state, const DataStore& store) {
+  static const DataStore* s_store = nullptr;
+  static uint16_t s_seen_gen[kSignalCount] = {};
+  SignalExtrema ext[kSignalCount];
+  if (!store.readExtrema(ext, kSignalCount)) return;
+  SignalMask changed = 0;
+  for (size_t i = 0; i < kSignalCount; ++i) {
+    if (&store != s_store || ext[i].gen != s_seen_gen[i]) {
+      changed |= static_cast<SignalMask>(1UL << i);
+      s_seen_gen[i] = ext[i].gen;
+    }
+  }
+  s_store = &store;
+  if (changed == 0) return;
+
   size_t page_count = 0;
   const PageDef* pages = GetPageTable(page_count);
-  ScreenSettings cfg{};
   for (size_t i = 0; i < page_count; ++i) {
-    cfg.imperial_units = GetPageUnits(state, static_cast<uint8_t>(i));
-    cfg.flip_180 = false;
-    float canon = 0.0f;
-    if (PageCanonicalValue(pages[i].id, state, cfg, store, now_ms, canon)) {
-      if (isnan(state.page_recorded_max[i]) || canon > state.page_recorded_max[i]) {
-        state.page_recorded_max[i] = canon;
-      }
-      if (isnan(state.page_recorded_min[i]) || canon < state.page_recorded_min[i]) {
-        state.page_recorded_min[i] = canon;
-      }
+    SignalId sig;
+    if (!PageSourceSignal(pages[i].id, state, sig)) continue;
+    const size_t s = static_cast<size_t>(sig);
+    if (s >= kSignalCount || !(changed & SignalBit(sig))) continue;
+    if (!ext[s].has_min || !ext[s].has_max) continue;
+    float a = 0.0f;
+    float b = 0.0f;
+    if (!PageCanonicalFromSignal(pages[i].id, state, ext[s].min, a) ||
+        !PageCanonicalFromSignal(pages[i].id, state, ext[s].max, b)) {
+      continue;
     }
+    const float hi = (a > b) ? a : b;
+    const float lo = (a > b) ? b : a;
+    if (isnan(state.page_recorded_max[i]) || hi > state.page_recorded_max[i]) {
+      state.page_recorded_max[i] = hi;
+    }
+    if (isnan(state.page_recorded_min[i]) || lo < state.page_recorded_min[i]) {
+      state.page_recorded_min[i] = lo;
+    }
+  }
+}
+
+namespace {
+
+constexpr uint32_t kLoopIdleMaxMs = 20;
+// Alerts re-run on input changes; otherwise only often enough for their
+// delay timers (>= 300 ms) and stale transitions.
+constexpr uint32_t kAlertsRefreshMs = 100;
+int8_t g_loop_can_sub = -1;
+
+// Alert settings the subscription mask was built from. The mask only moves
+// with the per-page alert enables and the user-sensor sources, so it is
+// rebuilt when one of those changes rather than on every tick.
+struct AlertInputSettings {
+  PageMask min_enabled;
+  PageMask max_enabled;
+  UserSensorSource source[2];
+};
+AlertInputSettings g_alert_inputs_cfg;
+
+AlertInputSettings CurrentAlertInputSettings() {
+  AlertInputSettings cfg;
+  cfg.min_enabled = g_state.page_alert_min_mask;
+  cfg.max_enabled = g_state.page_alert_max_mask;
+  cfg.source[0] = g_state.user_sensor[0].source;
+  cfg.source[1] = g_state.user_sensor[1].source;
+  return cfg;
+}
+
+void RefreshAlertSubscription() {
+  const AlertInputSettings cfg = CurrentAlertInputSettings();
+  if (cfg.min_enabled == g_alert_inputs_cfg.min_enabled &&
+      cfg.max_enabled == g_alert_inputs_cfg.max_enabled &&
+      cfg.source[0] == g_alert_inputs_cfg.source[0] &&
+      cfg.source[1] == g_alert_inputs_cfg.source[1]) {
+    return;
   }
+  g_alert_inputs_cfg = cfg;
+  g_datastore_can.setSubscriptionMask(g_loop_can_sub, g_alerts.inputMask(g_state));
+}
+
+uint32_t MsUntil(uint32_t deadline_ms, uint32_t now_ms) {
+  const int32_t d = static_cast<int32_t>(deadline_ms - now_ms);
+  return (d > 0) ? static_cast<uint32_t>(d) : 0U;
+}
+
+bool ZoneAlerting(uint8_t zone) {
+  return g_alerts.alertForPage(currentPageId(g_state, zone)) != AlertLevel::kNone;
+}
+
+// One UI render pass. With the display task running, frames are only handed
+// to the displays' back buffers; either way the time renderUi spent inside
+// frame sends is recorded as this tick's blocked time.
+void RenderUiTick(uint32_t now_ms, bool allow_oled1, bool allow_oled2) {
+  const bool async = DisplayTaskRunning();
+  g_oled_primary.setAsync(async);
+  g_oled_secondary.setAsync(async);
+  const uint32_t blocked_before =
+      g_oled_primary.sendBlockedUs() + g_oled_secondary.sendBlockedUs();
+  renderUi(g_state, ActiveStore(), g_oled_primary, g_oled_secondary, now_ms,
+           allow_oled1, allow_oled2, g_alerts);
+  const uint32_t blocked_us =
+      g_oled_primary.sendBlockedUs() + g_oled_secondary.sendBlockedUs() - blocked_before;
+  // Menus, the wizard and reboot messages outside renderUi keep sending inline.
+  g_oled_primary.setAsync(false);
+  g_oled_secondary.setAsync(false);
+  if (async) DisplayTaskKick();
+  DisplayRecordLoopBlocked(blocked_us, now_ms);
+}
+
+}  // namespace
+
+void AppLoopInitWakeups() {
+  AppRegisterLoopTask();
+  g_alert_inputs_cfg = CurrentAlertInputSettings();
+  g_loop_can_sub = g_datastore_can.subscribe(
+      g_alerts.inputMask(g_state), [](void*) { AppWakeLoop(); });
 }
 
 void AppLoopTick() {
@@ -283,6 +389,7 @@ void AppLoopTick() {
           safe_i2c ? AppConfig::kSafeCableRuntimeI2cHz
                    : AppConfig::kI2c2FrequencyHz;
       if (elapsed <= 5000U && !i2c_clock_raised) {
+        OledU8g2::IoLock io_lock(g_oled_primary);  // keep the display task off the bus
         Wire.setClock(oled1_boot_hz);
       }
       const bool retry_due =
@@ -313,6 +420,7 @@ void AppLoopTick() {
         }
 
         if (!primary_ready) {
+          OledU8g2::IoLock io_lock(g_oled_primary);  // keep the display task off the bus
           const bool recovered =
               RecoverI2cBus(Pins::kI2cSda, Pins::kI2cScl, "OLED1",
                             kEnableVerboseSerialLogs);
@@ -365,6 +473,7 @@ void AppLoopTick() {
         }
 
         if (!secondary_ready) {
+          OledU8g2::IoLock io_lock(g_oled_secondary);  // keep the display task off the bus
           const bool recovered =
               RecoverI2cBus(Pins::kI2c2Sda, Pins::kI2c2Scl, "OLED2",
                             kEnableVerboseSerialLogs);
@@ -485,6 +594,7 @@ void AppLoopTick() {
 
         const bool primary_ack = primary_ready ? ProbeOled1Ack() : false;
         if (!primary_ready || !primary_ack) {
+          OledU8g2::IoLock io_lock(g_oled_primary);  // keep the display task off the bus
           any_attempt = true;
           g_oled_primary.setBusClockHz(watchdog_slow_hz);
           RecoverI2cBus(Pins::kI2cSda, Pins::kI2cScl, "OLED1",
@@ -539,6 +649,7 @@ void AppLoopTick() {
         const bool secondary_ack =
             secondary_ready ? g_oled_secondary.probeAddress() : false;
         if (!secondary_ready || !secondary_ack) {
+          OledU8g2::IoLock io_lock(g_oled_secondary);  // keep the display task off the bus
           any_attempt = true;
           g_oled_secondary.setBusClockHz(watchdog_slow_hz);
           RecoverI2cBus(Pins::kI2c2Sda, Pins::kI2c2Scl, "OLED2",
@@ -613,6 +724,7 @@ void AppLoopTick() {
   if (kEnableBootI2cScan) {
     if (!g_i2c_seen && g_i2c_scan_attempts < 4 &&
         (now_ms - g_last_i2c_scan_ms) >= 5000U) {
+      OledU8g2::IoLock io_lock(g_oled_primary);  // scan and rebind reprogram Wire
       g_i2c_seen = ScanI2cBuses();
       Wire.begin(Pins::kI2cSda, Pins::kI2cScl);
       g_wire_sda_pin = Pins::kI2cSda;
@@ -731,8 +843,7 @@ void AppLoopTick() {
     if (allow_oled_wifi) {
       last_wifi_render_ms = now_ms;
       AutoAcquireBaro(g_state, now_ms);
-      renderUi(g_state, ActiveStore(), g_oled_primary, g_oled_secondary, now_ms,
-               true, true, g_alerts);
+      RenderUiTick(now_ms, true, true);
     }
     PersistRuntimeTick(now_ms);
     AppSleepMs(1);
@@ -762,11 +873,19 @@ void AppLoopTick() {
   }
 #endif
 
-  g_alerts.update(g_state, ActiveStore(), now_ms);
+  // Consume pending change bits; anything written from here on wakes the
+  // idle wait at the end of this tick. Deadbanded repeats set no bits.
+  static uint32_t last_alerts_ms = 0;
+  const SignalMask alert_inputs_changed = g_datastore_can.takeDirty(g_loop_can_sub);
+  if (alert_inputs_changed != 0 || g_state.demo_mode ||
+      (now_ms - last_alerts_ms) >= kAlertsRefreshMs) {
+    g_alerts.update(g_state, ActiveStore(), now_ms);
+    last_alerts_ms = now_ms;
+  }
   const bool want_can = AppConfig::kCanRuntimeSupported &&
                         AppConfig::IsRealCanEnabled() && !g_state.demo_mode;
   if (prev_demo && want_can) {
-    g_datastore_can = DataStore();  // clear demo values; show stale until CAN updates
+    g_datastore_can.clear();  // clear demo values; show stale until CAN updates
     for (uint8_t z = 0; z < kMaxZones; ++z) {
       g_state.force_redraw[z] = true;
     }
@@ -782,6 +901,7 @@ void AppLoopTick() {
   }
 
   AutoAcquireBaro(g_state, now_ms);
+  WarmStartTick(g_state, g_datastore_can, now_ms);
 
   if (g_state.self_test_enabled) {
     if ((now_ms - g_state.self_test.last_step_ms) >=
@@ -798,7 +918,7 @@ void AppLoopTick() {
     g_state.self_test.request_reset_all = false;
   }
 
-  updateRecordedExtrema(g_state, ActiveStore(), now_ms);
+  updateRecordedExtrema(g_state, ActiveStore());
 
   // Edit timeout
   for (uint8_t scr = 0; scr < kMaxZones; ++scr) {
@@ -848,28 +968,25 @@ void AppLoopTick() {
       g_state.edit_mode.mode[secondary_zone_id] != EditModeState::Mode::kNone &&
       g_state.edit_mode.page[secondary_zone_id] ==
           currentPageIndex(g_state, secondary_zone_id);
-  uint32_t oled1_bus_hz = g_oled_primary.busClockHz();
-  if (oled1_bus_hz == 0) {
-    oled1_bus_hz = AppConfig::kI2cFrequencyHz;
+  {
+    // A display is urgent while it shows the focused zone or an alerting page.
+    const bool large = g_state.display_topology == DisplayTopology::kLargeOnly ||
+                       g_state.display_topology == DisplayTopology::kLargePlusSmall;
+    const uint8_t focus = g_state.dual_screens ? g_state.focus_screen : 0;
+    const bool primary_urgent = focus == 0 || (large && focus == 1) || ZoneAlerting(0) ||
+                                (large && ZoneAlerting(1));
+    const bool secondary_urgent =
+        focus == secondary_zone_id || ZoneAlerting(secondary_zone_id);
+    DisplaySchedulerTick(g_state.oled_primary_ready,
+                         g_state.dual_screens && g_state.oled_secondary_ready,
+                         primary_urgent, secondary_urgent, want_can);
   }
-  uint32_t oled1_interval = (oled1_bus_hz <= 25000U) ? 250U : 125U;
+  const uint32_t oled1_interval = DisplayFrameIntervalMs(false);
   bool allow_oled1 =
       (now_ms - g_state.last_oled_ms[0] >= oled1_interval) ||
       g_state.force_redraw[0];
 
-  uint32_t oled2_bus_hz = g_oled_secondary.busClockHz();
-  if (oled2_bus_hz == 0) {
-    oled2_bus_hz = AppConfig::kI2c2FrequencyHz;
-  }
-  uint32_t oled2_interval = 250U;
-  if (oled2_bus_hz <= 25000U) {
-    // Slow bus: reduce update rate under load to avoid jitter.
-    oled2_interval = (want_can ? 400U : 250U);
-  } else if (oled2_bus_hz <= 50000U) {
-    oled2_interval = 250U;
-  } else {
-    oled2_interval = 250U;
-  }
+  uint32_t oled2_interval = DisplayFrameIntervalMs(true);
   if (editing_oled2 && oled2_interval < 250U) {
     oled2_interval = 250U;
   }
@@ -881,29 +998,13 @@ void AppLoopTick() {
     prev_focus = g_state.focus_screen;
   }
   bool allow_oled2 =
-      ((now_ms - g_state.last_oled_ms[secondary_zone_id] >= oled2_interval) ||
-       g_state.force_redraw[secondary_zone_id]) &&
-      ((now_ms - g_state.last_oled_ms[0]) >= 50U);
-
-  // Stagger at very slow I2C: never send both buffers in the same tick.
-  static bool prefer_primary_next = true;
-  const bool slow_bus =
-      (g_oled_primary.busClockHz() != 0 &&
-       g_oled_primary.busClockHz() <= 25000U) ||
-      (g_oled_secondary.busClockHz() != 0 &&
-       g_oled_secondary.busClockHz() <= 25000U);
-  if (slow_bus && allow_oled1 && allow_oled2) {
-    if (prefer_primary_next) {
-      allow_oled2 = false;
-    } else {
-      // Defer OLED1 this tick.
-      if (!g_state.force_redraw[0]) {
-        allow_oled1 = false;
-      } else {
-        allow_oled2 = false;
-      }
-    }
-    prefer_primary_next = !prefer_primary_next;
+      (now_ms - g_state.last_oled_ms[secondary_zone_id] >= oled2_interval) ||
+      g_state.force_redraw[secondary_zone_id];
+
+  // The display task orders and staggers the two transfers itself; inline
+  // sends must not put two long transfers on the bus in the same tick.
+  if (!DisplayTaskRunning()) {
+    DisplayStaggerInline(allow_oled1, allow_oled2, g_state.force_redraw[0]);
   }
 
   // FPS instrumentation
@@ -915,19 +1016,43 @@ void AppLoopTick() {
   const bool rendered2 =
       (allow_oled2 && g_state.oled_secondary_ready);  // candidate for counting
 
-  renderUi(g_state, ActiveStore(), g_oled_primary, g_oled_secondary, now_ms,
-           allow_oled1, allow_oled2, g_alerts);
+  RenderUiTick(now_ms, allow_oled1, allow_oled2);
 
   if (rendered1) ++fps1_count;
   if (rendered2) ++fps2_count;
   if ((now_ms - last_fps_print_ms) >= 1000U) {
-    LOGI("OLED1 fps=%lu OLED2 fps=%lu\r\n",
+    const DisplayBlockStats blocked = DisplayLoopBlockStats();
+    const DisplayRateStats rate1 = DisplayRate(false);
+    const DisplayRateStats rate2 = DisplayRate(true);
+    LOGI("OLED1 fps=%lu (%lums, tx %luus) OLED2 fps=%lu (%lums, tx %luus) "
+         "send-blocked avg=%luus max=%luus (%s)\r\n",
          static_cast<unsigned long>(fps1_count),
-         static_cast<unsigned long>(fps2_count));
+         static_cast<unsigned long>(rate1.interval_ms),
+         static_cast<unsigned long>(rate1.transfer_us),
+         static_cast<unsigned long>(fps2_count),
+         static_cast<unsigned long>(rate2.interval_ms),
+         static_cast<unsigned long>(rate2.transfer_us),
+         static_cast<unsigned long>(blocked.avg_us),
+         static_cast<unsigned long>(blocked.max_us),
+         DisplayTaskRunning() ? "task" : "inline");
     fps1_count = 0;
     fps2_count = 0;
     last_fps_print_ms = now_ms;
   }
   PersistRuntimeTick(now_ms);
-  AppSleepMs(1);
+
+  // Idle until the next OLED slot, a button event or a change to a signal
+  // that can move an alert. The loop-side TWAI fallback still polls at 1 ms.
+  uint32_t idle_ms = kLoopIdleMaxMs;
+  if (want_can && !CanRxTaskRunning()) {
+    idle_ms = 1;
+  }
+  const uint32_t oled1_due = MsUntil(g_state.last_oled_ms[0] + oled1_interval, now_ms);
+  const uint32_t oled2_due =
+      MsUntil(g_state.last_oled_ms[secondary_zone_id] + oled2_interval, now_ms);
+  if (oled1_due < idle_ms) idle_ms = oled1_due;
+  if (oled2_due < idle_ms) idle_ms = oled2_due;
+  if (idle_ms == 0) idle_ms = 1;
+  RefreshAlertSubscription();
+  AppWaitForWork(idle_ms);
 }
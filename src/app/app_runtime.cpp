@@ -60,6 +60,40 @@ DataStore& ActiveStore() {
   return g_state.demo_mode ? g_datastore_demo : g_datastore_can;
 }
 
+void ResetSignalExtrema(bool reset_min, bool reset_max) {
+  g_datastore_can.requestExtremaReset(reset_min, reset_max);
+  g_datastore_demo.requestExtremaReset(reset_min, reset_max);
+}
+
+void ApplySignalFilters() {
+  SignalFilterCfg cfg[kSignalCount];
+  portENTER_CRITICAL(&g_state_mux);
+  for (size_t i = 0; i < kSignalCount; ++i) {
+    cfg[i] = g_state.signal_filter[i];
+  }
+  portEXIT_CRITICAL(&g_state_mux);
+  g_filters_can.configure(cfg, kSignalCount);
+  g_filters_demo.configure(cfg, kSignalCount);
+}
+
+bool ApplyDerivedChannels() {
+  DerivedChannelCfg cfg[kDerivedChannelCount];
+  portENTER_CRITICAL(&g_state_mux);
+  for (uint8_t i = 0; i < kDerivedChannelCount; ++i) {
+    cfg[i] = g_state.derived[i];
+  }
+  portEXIT_CRITICAL(&g_state_mux);
+  uint8_t bad = 0;
+  const char* err = nullptr;
+  if (!g_derived_can.configure(cfg, kDerivedChannelCount, &bad, &err)) {
+    LOGW("[DERIVED] DRV%u \"%s\": %s\r\n", static_cast<unsigned>(bad + 1),
+         cfg[bad].expr, err ? err : "?");
+    return false;
+  }
+  g_derived_demo.configure(cfg, kDerivedChannelCount);
+  return true;
+}
+
 void ResetBaroPersist() {
   SetupPersist persist{};
   g_nvs.loadSetupPersist(persist);
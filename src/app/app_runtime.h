@@ -4,4 +4,6 @@
 
 void AppSetup();
 void AppLoopTick();
+// Registers the loop task for wakeups (CAN data subscription, buttons).
+void AppLoopInitWakeups();
 void ResetBaroPersist();
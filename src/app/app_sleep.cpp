@@ -5,6 +5,12 @@
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 
+namespace {
+
+TaskHandle_t g_loop_task = nullptr;
+
+}  // namespace
+
 void AppSleepMs(uint32_t ms) {
   if (xTaskGetSchedulerState() == taskSCHEDULER_RUNNING) {
     vTaskDelay(pdMS_TO_TICKS(ms));
@@ -12,3 +18,20 @@ void AppSleepMs(uint32_t ms) {
   }
   delay(ms);
 }
+
+void AppRegisterLoopTask() { g_loop_task = xTaskGetCurrentTaskHandle(); }
+
+void AppWakeLoop() {
+  TaskHandle_t task = g_loop_task;
+  if (task) {
+    xTaskNotifyGive(task);
+  }
+}
+
+void AppWaitForWork(uint32_t max_ms) {
+  if (!g_loop_task || xTaskGetSchedulerState() != taskSCHEDULER_RUNNING) {
+    AppSleepMs(max_ms);
+    return;
+  }
+  ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(max_ms));
+}
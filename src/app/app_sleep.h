@@ -3,3 +3,9 @@
 #include <stdint.h>
 
 void AppSleepMs(uint32_t ms);
+
+// Main-loop idling: the loop blocks in AppWaitForWork() and producers (CAN
+// data subscriptions, button task) cut the wait short with AppWakeLoop().
+void AppRegisterLoopTask();
+void AppWakeLoop();
+void AppWaitForWork(uint32_t max_ms);
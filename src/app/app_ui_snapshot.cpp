@@ -37,6 +37,12 @@ void GetAppUiSnapshot(AppUiSnapshot& out) {
   out.can_health = g_state.can_link.health;
   out.user_sensor[0] = g_state.user_sensor[0];
   out.user_sensor[1] = g_state.user_sensor[1];
+  for (size_t i = 0; i < kSignalCount; ++i) {
+    out.signal_filter[i] = g_state.signal_filter[i];
+  }
+  for (uint8_t i = 0; i < kDerivedChannelCount; ++i) {
+    out.derived[i] = g_state.derived[i];
+  }
   out.stoich_afr = g_state.stoich_afr;
   out.afr_show_lambda = g_state.afr_show_lambda;
   strlcpy(out.ecu_type, g_state.ecu_type, sizeof(out.ecu_type));
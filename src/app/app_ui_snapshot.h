@@ -20,16 +20,18 @@ struct AppUiSnapshot {
   float page_recorded_min[kPageCount] = {};
   float page_recorded_max[kPageCount] = {};
   Thresholds thresholds[kPageCount] = {};
-  uint32_t page_units_mask = 0;
-  uint32_t page_alert_max_mask = 0;
-  uint32_t page_alert_min_mask = 0;
-  uint32_t page_hidden_mask = 0;
+  PageMask page_units_mask;
+  PageMask page_alert_max_mask;
+  PageMask page_alert_min_mask;
+  PageMask page_hidden_mask;
   uint32_t can_bitrate_value = 0;
   bool can_bitrate_locked = false;
   bool can_ready = false;
   bool can_safe_listen = false;
   CanHealth can_health = CanHealth::kNoFrames;
   UserSensorCfg user_sensor[2] = {};
+  SignalFilterCfg signal_filter[kSignalCount] = {};
+  DerivedChannelCfg derived[kDerivedChannelCount] = {};
   float stoich_afr = 0.0f;
   bool afr_show_lambda = false;
   char ecu_type[8] = "";
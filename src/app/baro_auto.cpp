@@ -12,9 +12,11 @@ struct BaroAutoContext {
   uint32_t count = 0;
   float min_kpa = 0.0f;
   float max_kpa = 0.0f;
+  uint32_t last_sample_ms = 0;
 };
 
 BaroAutoContext g_baro_auto;
+int8_t g_baro_sub = -1;
 
 }  // namespace
 
@@ -24,6 +26,11 @@ void ResetBaroAuto() {
   g_baro_auto.count = 0;
   g_baro_auto.min_kpa = 0.0f;
   g_baro_auto.max_kpa = 0.0f;
+  g_baro_auto.last_sample_ms = 0;
+}
+
+void InitBaroAuto() {
+  g_baro_sub = g_datastore_can.subscribe(SignalBit(SignalId::kRpm) | SignalBit(SignalId::kMap));
 }
 
 void AutoAcquireBaro(AppState& state, uint32_t now_ms) {
@@ -32,6 +39,7 @@ void AutoAcquireBaro(AppState& state, uint32_t now_ms) {
   const uint32_t kWindowMs = 1200;
   const uint32_t kMinSamples = 8;
   const float kStableDeltaKpa = 1.5f;
+  const uint32_t kResampleMs = 100;
 
   if (state.baro_acquired || state.demo_mode || !AppConfig::IsRealCanEnabled() ||
       !state.can_ready) {
@@ -39,19 +47,31 @@ void AutoAcquireBaro(AppState& state, uint32_t now_ms) {
     return;
   }
 
-  const DataStore& store = ActiveStore();
-  const SignalRead rpm = store.get(SignalId::kRpm, now_ms);
+  // Sample when RPM or MAP changes. A steady MAP inside its deadband sets no
+  // change bits, so an open window is topped up every kResampleMs instead.
+  const SignalMask changed = g_datastore_can.takeDirty(g_baro_sub);
+  if (changed == 0 && g_baro_auto.count > 0 &&
+      (now_ms - g_baro_auto.last_sample_ms) < kResampleMs) {
+    return;
+  }
+
+  // RPM and MAP must come from the same frame for the engine-off check.
+  SignalSnapshot snap;
+  ActiveStore().snapshot(SignalBit(SignalId::kRpm) | SignalBit(SignalId::kMap),
+                         snap, now_ms);
+  const SignalRead rpm = snap.get(SignalId::kRpm);
   if (!rpm.valid || rpm.age_ms > kMaxAgeMs || rpm.value >= kRpmThreshold) {
     ResetBaroAuto();
     return;
   }
-  const SignalRead map = store.get(SignalId::kMap, now_ms);
+  const SignalRead map = snap.get(SignalId::kMap);
   if (!map.valid || map.age_ms > kMaxAgeMs) {
     ResetBaroAuto();
     return;
   }
 
   const float map_kpa = map.value;
+  g_baro_auto.last_sample_ms = now_ms;
   if (g_baro_auto.window_start_ms == 0) {
     g_baro_auto.window_start_ms = now_ms;
     g_baro_auto.sum_kpa = 0.0f;
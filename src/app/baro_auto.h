@@ -4,5 +4,7 @@
 
 #include "app_state.h"
 
+// Boot-time: subscribes to RPM/MAP changes on the CAN store.
+void InitBaroAuto();
 void ResetBaroAuto();
 void AutoAcquireBaro(AppState& state, uint32_t now_ms);
@@ -37,6 +37,12 @@ void flushButtonQueue() {
   });
 }
 
+// Queues a UI action and wakes the main loop so it is handled immediately.
+static void PostButtonMsg(const BtnMsg& msg) {
+  xQueueSend(g_btnQueue, &msg, 0);
+  AppWakeLoop();
+}
+
 static void ButtonTask(void* arg) {
   (void)arg;
   constexpr uint8_t kIntegratorMax = 20;  // ~20 ms at 1 kHz
@@ -75,6 +81,7 @@ static void ButtonTask(void* arg) {
         g_state.btn_pressed = true;
         g_state.last_input_ms = now_ms;
       });
+      AppWakeLoop();
       lock_armed = (lock_clicks == 3);
       failsafe_pending = false;
     }
@@ -110,7 +117,7 @@ static void ButtonTask(void* arg) {
           UiAction act =
               (dur >= 3000U) ? UiAction::kUnlockGesture : UiAction::kLockGesture;
           BtnMsg msg{act, now_ms};
-          xQueueSend(g_btnQueue, &msg, 0);
+          PostButtonMsg(msg);
           lock_clicks = 0;
           lock_window_start_ms = 0;
           lock_armed = false;
@@ -138,7 +145,7 @@ static void ButtonTask(void* arg) {
         UiAction act =
             (click_count == 0) ? UiAction::kLong : UiAction::kClick1Long;
         BtnMsg msg{act, now_ms};
-        xQueueSend(g_btnQueue, &msg, 0);
+        PostButtonMsg(msg);
         click_count = 0;
         WithStateLock([&]() {
           g_state.btn_pending_count = 0;
@@ -198,7 +205,7 @@ static void ButtonTask(void* arg) {
         }
         if (act != UiAction::kNone) {
           BtnMsg msg{act, now_ms};
-          xQueueSend(g_btnQueue, &msg, 0);
+          PostButtonMsg(msg);
           WithStateLock([&]() {
             g_state.last_input_ms = now_ms;
           });
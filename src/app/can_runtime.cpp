@@ -14,6 +14,7 @@
 #include "app/app_globals.h"
 #include "app_config.h"
 #include "config/logging.h"
+#include "ecu/decode_cache.h"
 #include "ecu/ecu_profile.h"
 #include "pins.h"
 #include "freertos/FreeRTOS.h"
@@ -23,44 +24,58 @@
 
 namespace {
 
-bool InRange(SignalId id, float phys) {
-  switch (id) {
-    case SignalId::kBatt:
-      return phys >= 6.0f && phys <= 18.5f;
-    case SignalId::kRpm:
-      return phys >= 0.0f && phys <= 12000.0f;
-    case SignalId::kMap:
-      return phys >= 0.0f && phys <= 400.0f;  // kPa abs
-    case SignalId::kTps:
-      return phys >= 0.0f && phys <= 100.0f;
-    case SignalId::kClt:
-    case SignalId::kMat:
-      return phys >= -40.0f && phys <= 300.0f;  // degF
-    case SignalId::kAdv:
-    case SignalId::kLaunchTiming:
-    case SignalId::kTcRetard:
-      return phys >= -40.0f && phys <= 80.0f;
-    case SignalId::kAfr1:
-    case SignalId::kAfrTarget1:
-      return phys >= 5.0f && phys <= 25.0f;
-    case SignalId::kVss1:
-      return phys >= 0.0f && phys <= 120.0f;  // m/s ~ 432 km/h
-    case SignalId::kPw1:
-    case SignalId::kPw2:
-    case SignalId::kPwSeq1:
-      return phys >= 0.0f && phys <= 50.0f;  // ms
-    case SignalId::kEgoCor1:
-      return phys >= -50.0f && phys <= 200.0f;  // %
-    case SignalId::kEgt1:
-      return phys >= 0.0f && phys <= 2000.0f;  // degF (table uses degF)
-    case SignalId::kKnkRetard:
-      return phys >= 0.0f && phys <= 20.0f;
-    case SignalId::kSensors1:
-    case SignalId::kSensors2:
-      return true;  // user-defined sensors: do not gate here
-    default:
-      return true;
+// Only one of the RX task / CanRuntimeTick() ingests at a time.
+DecodeCache g_decode_cache;
+
+// Decodes `msg` and gates the batch against the registry limits (contract +
+// profile overrides): one pass for the checks, one critical section for the
+// counters, then one grouped store write. A payload identical to the last one
+// for its ID skips decode and checks and replays the cached result; the
+// store's deadband makes that a freshness-only refresh. False if the profile
+// did not decode the frame.
+bool IngestFrame(const IEcuProfile& profile, const twai_message_t& msg, uint32_t now_ms) {
+  const DecodedSignal* decoded = nullptr;
+  uint8_t count = 0;
+  uint32_t reject = 0;
+  DecodedSignal scratch[DecodeCache::kMaxSignals];
+  const DecodeCache::Entry* hit =
+      g_decode_cache.find(msg.identifier, msg.extd, msg.data_length_code, msg.data);
+  if (hit) {
+    decoded = hit->batch;
+    count = hit->count;
+    reject = hit->reject;
+  } else {
+    if (!profile.decode(msg, scratch, count)) return false;
+    const SignalRegistry& registry = SignalRegistry::instance();
+    reject = SignalRejectMask(registry.limits(), registry.count(), scratch, count);
+    g_decode_cache.store(msg.identifier, msg.extd, msg.data_length_code, msg.data,
+                         scratch, count, reject);
+    decoded = scratch;
   }
+  portENTER_CRITICAL(&g_state_mux);
+  ++g_state.can_stats.rx_dash;
+  if (hit) ++g_state.can_stats.decode_repeat;
+  // One count per rejected signal, as before the batch check; the link health
+  // thresholds are tuned for that unit.
+  g_state.can_stats.decode_oob += static_cast<uint32_t>(__builtin_popcount(reject));
+  portEXIT_CRITICAL(&g_state_mux);
+#ifdef DEBUG_STALE_OLED2
+  for (uint8_t i = 0; i < count; ++i) {
+    if (decoded[i].id == SignalId::kMap && kEnableVerboseSerialLogs) {
+      if (reject & (1UL << i)) {
+        LOGI("[MAP] reject OOR ts=%lu val=%.3f\n",
+             static_cast<unsigned long>(now_ms),
+             static_cast<double>(decoded[i].phys));
+      } else {
+        LOGI("[MAP] update ts=%lu val=%.3f\n", static_cast<unsigned long>(now_ms),
+             static_cast<double>(decoded[i].phys));
+      }
+    }
+  }
+#endif
+  // One sequence bump per message: readers never see half a frame.
+  g_datastore_can.updateGroup(decoded, count, now_ms, reject);
+  return true;
 }
 
 }  // namespace
@@ -203,6 +218,8 @@ void UpdateCanHealth(AppState& s, uint32_t now_ms) {
   (void)can_fault;  // no automatic listen-only fallback
 }
 
+bool CanRxTaskRunning() { return g_can_rx_task_started; }
+
 uint32_t CanRxTaskWatermark() {
   if (!g_can_rx_task) return 0;
   return uxTaskGetStackHighWaterMark(g_can_rx_task);
@@ -283,7 +300,6 @@ static void CanRxTaskEntry(void* arg) {
   (void)arg;
   const IEcuProfile& profile = g_ecu_mgr.profile();
   twai_message_t msg;
-  Ms3SignalValue decoded[8];
   for (;;) {
     if (!AppConfig::kUseRealCanData || !g_state.can_ready || !g_twai.isStarted()) {
       vTaskDelay(pdMS_TO_TICKS(5));
@@ -306,11 +322,7 @@ static void CanRxTaskEntry(void* arg) {
       ++g_state.can_stats.rx_match;
       g_state.last_can_match_ms = now_ms;
       portEXIT_CRITICAL(&g_state_mux);
-      uint8_t count = 0;
-      if (profile.decode(msg, decoded, count)) {
-        portENTER_CRITICAL(&g_state_mux);
-        ++g_state.can_stats.rx_dash;
-        portEXIT_CRITICAL(&g_state_mux);
+      if (IngestFrame(profile, msg, now_ms)) {
         const int idx = profile.dashIndexForId(msg.identifier);
         const bool idx_valid = idx >= 0;
         const bool per_id_valid = idx_valid && (idx < 5);
@@ -321,16 +333,6 @@ static void CanRxTaskEntry(void* arg) {
             (msg.data_length_code > sizeof(last_bytes)) ? sizeof(last_bytes)
                                                         : msg.data_length_code;
         memcpy(last_bytes, msg.data, copy_len);
-        for (uint8_t i = 0; i < count; ++i) {
-          if (!InRange(decoded[i].id, decoded[i].phys)) {
-            portENTER_CRITICAL(&g_state_mux);
-            ++g_state.can_stats.decode_oob;
-            portEXIT_CRITICAL(&g_state_mux);
-            g_datastore_can.note_invalid(decoded[i].id, now_ms);
-            continue;
-          }
-          g_datastore_can.update(decoded[i].id, decoded[i].phys, now_ms);
-        }
         portENTER_CRITICAL(&g_state_mux);
         if (idx_valid) {
           g_state.id_present_mask |= static_cast<uint8_t>(1U << idx);
@@ -419,7 +421,6 @@ void CanRuntimeTick(uint32_t now_ms) {
 
   const IEcuProfile& profile = g_ecu_mgr.profile();
   twai_message_t msg;
-  Ms3SignalValue decoded[8];
   while (g_twai.receive(msg, 0)) {
     portENTER_CRITICAL(&g_state_mux);
     g_state.last_can_rx_ms = now_ms;
@@ -436,11 +437,7 @@ void CanRuntimeTick(uint32_t now_ms) {
     portENTER_CRITICAL(&g_state_mux);
     g_state.last_can_match_ms = now_ms;
     portEXIT_CRITICAL(&g_state_mux);
-    uint8_t count = 0;
-    if (profile.decode(msg, decoded, count)) {
-      portENTER_CRITICAL(&g_state_mux);
-      ++g_state.can_stats.rx_dash;
-      portEXIT_CRITICAL(&g_state_mux);
+    if (IngestFrame(profile, msg, now_ms)) {
       const int idx = profile.dashIndexForId(msg.identifier);
       uint8_t id_mask_bit = 0;
       bool per_id_valid = false;
@@ -448,42 +445,6 @@ void CanRuntimeTick(uint32_t now_ms) {
         id_mask_bit = static_cast<uint8_t>(1U << idx);
         per_id_valid = (idx < 5);
       }
-      for (uint8_t i = 0; i < count; ++i) {
-        if (!InRange(decoded[i].id, decoded[i].phys)) {
-          portENTER_CRITICAL(&g_state_mux);
-          ++g_state.can_stats.decode_oob;
-          portEXIT_CRITICAL(&g_state_mux);
-#ifdef DEBUG_STALE_OLED2
-          if (decoded[i].id == SignalId::kMap) {
-            if (kEnableVerboseSerialLogs) {
-              LOGI("[MAP] reject OOR ts=%lu val=%.3f\n",
-                   static_cast<unsigned long>(now_ms),
-                   static_cast<double>(decoded[i].phys));
-            }
-          }
-#endif
-          g_datastore_can.note_invalid(decoded[i].id, now_ms);
-          continue;
-        }
-#ifdef DEBUG_STALE_OLED2
-        if (decoded[i].id == SignalId::kMap) {
-          if (isnan(decoded[i].phys) || isinf(decoded[i].phys)) {
-            if (kEnableVerboseSerialLogs) {
-              LOGI("[MAP] reject NAN/INF ts=%lu val=%.3f\n",
-                   static_cast<unsigned long>(now_ms),
-                   static_cast<double>(decoded[i].phys));
-            }
-          } else {
-            if (kEnableVerboseSerialLogs) {
-              LOGI("[MAP] update ts=%lu val=%.3f\n",
-                   static_cast<unsigned long>(now_ms),
-                   static_cast<double>(decoded[i].phys));
-            }
-          }
-        }
-#endif
-        g_datastore_can.update(decoded[i].id, decoded[i].phys, now_ms);
-      }
       const uint32_t last_id = msg.identifier;
       const uint8_t last_dlc = msg.data_length_code;
       uint8_t last_bytes[8];
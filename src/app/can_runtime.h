@@ -7,3 +7,5 @@
 void CanRuntimeTick(uint32_t now_ms);
 void StartCanRxTask();
 uint32_t CanRxTaskWatermark();
+// True once frames are received on the dedicated task (not the loop fallback).
+bool CanRxTaskRunning();
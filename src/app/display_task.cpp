@@ -0,0 +1,157 @@
+#include "app/display_task.h"
+
+#include <Arduino.h>
+
+#include "app/app_globals.h"
+#include "app/frame_scheduler.h"
+#include "app_config.h"
+#include "drivers/oled_u8g2.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+namespace {
+
+// Budget of wall time both displays' transfers may take together.
+constexpr uint8_t kBusBudgetPct = 60;
+constexpr uint8_t kBusBudgetCanPct = 40;  // CAN RX shares the single core
+// Two transfers longer than this together are split across ticks, with a
+// pause between them on the task, so neither the loop nor CAN RX stalls.
+constexpr uint32_t kBurstLimitUs = 50000;
+constexpr uint32_t kStaggerGapMs = 50;
+constexpr uint32_t kIdleWaitMs = 100;
+
+TaskHandle_t g_display_task = nullptr;
+bool g_display_task_started = false;
+
+FrameScheduler g_scheduler;
+portMUX_TYPE g_scheduler_mux = portMUX_INITIALIZER_UNLOCKED;
+OledU8g2::FrameStats g_stats_seen[FrameScheduler::kDisplays];
+
+uint32_t g_block_sum_us = 0;
+uint32_t g_block_max_us = 0;
+uint32_t g_block_ticks = 0;
+uint32_t g_block_window_ms = 0;
+DisplayBlockStats g_block_last;
+
+OledU8g2& Display(uint8_t index) { return index == 0 ? g_oled_primary : g_oled_secondary; }
+
+bool BurstTooLong() {
+  portENTER_CRITICAL(&g_scheduler_mux);
+  const uint32_t both_us = g_scheduler.rate(0).transfer_us + g_scheduler.rate(1).transfer_us;
+  portEXIT_CRITICAL(&g_scheduler_mux);
+  return both_us > kBurstLimitUs;
+}
+
+uint8_t PickFirst() {
+  portENTER_CRITICAL(&g_scheduler_mux);
+  const uint8_t first = g_scheduler.pickFirst();
+  portEXIT_CRITICAL(&g_scheduler_mux);
+  return first;
+}
+
+void DisplayTaskEntry(void*) {
+  uint32_t wait_ms = kIdleWaitMs;
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(wait_ms));
+    wait_ms = kIdleWaitMs;
+    if (!g_oled_primary.framePending() || !g_oled_secondary.framePending()) {
+      g_oled_primary.transferPending();
+      g_oled_secondary.transferPending();
+      continue;
+    }
+    const uint8_t first = PickFirst();
+    Display(first).transferPending();
+    if (BurstTooLong()) {
+      vTaskDelay(pdMS_TO_TICKS(kStaggerGapMs));
+      wait_ms = 0;  // the other display goes out on the next pass
+      continue;
+    }
+    Display(first ^ 1).transferPending();
+  }
+}
+
+}  // namespace
+
+void StartDisplayTask() {
+  if (!AppConfig::kDisplayTaskEnabled || g_display_task_started) return;
+  const BaseType_t ok = xTaskCreatePinnedToCore(DisplayTaskEntry, "oled_tx", 3072, nullptr,
+                                                1, &g_display_task, 0);
+  if (ok == pdPASS) {
+    g_display_task_started = true;
+  }
+}
+
+bool DisplayTaskRunning() { return g_display_task_started; }
+
+void DisplayTaskKick() {
+  if (g_display_task) {
+    xTaskNotifyGive(g_display_task);
+  }
+}
+
+void DisplaySchedulerTick(bool primary_on, bool secondary_on, bool primary_urgent,
+                          bool secondary_urgent, bool can_load) {
+  const uint32_t default_hz[FrameScheduler::kDisplays] = {AppConfig::kI2cFrequencyHz,
+                                                          AppConfig::kI2c2FrequencyHz};
+  const bool active[FrameScheduler::kDisplays] = {primary_on, secondary_on};
+  const bool urgent[FrameScheduler::kDisplays] = {primary_urgent, secondary_urgent};
+  portENTER_CRITICAL(&g_scheduler_mux);
+  for (uint8_t d = 0; d < FrameScheduler::kDisplays; ++d) {
+    const OledU8g2& oled = Display(d);
+    const OledU8g2::FrameStats& now = oled.frameStats();
+    OledU8g2::FrameStats& seen = g_stats_seen[d];
+    g_scheduler.setBusClock(d, oled.busClockHz() ? oled.busClockHz() : default_hz[d]);
+    // Frames skipped before the send count as unchanged frames: they mark
+    // the display static but stay out of the transfer-time mean.
+    const uint32_t skipped = now.skipped_frames - seen.skipped_frames;
+    g_scheduler.recordTransfers(d, now.frames - seen.frames + skipped,
+                                now.transfer_us_total - seen.transfer_us_total,
+                                now.unchanged_frames - seen.unchanged_frames + skipped);
+    seen = now;
+  }
+  g_scheduler.update(active, urgent, can_load ? kBusBudgetCanPct : kBusBudgetPct);
+  portEXIT_CRITICAL(&g_scheduler_mux);
+}
+
+uint32_t DisplayFrameIntervalMs(bool secondary) {
+  portENTER_CRITICAL(&g_scheduler_mux);
+  const uint32_t interval_ms = g_scheduler.rate(secondary ? 1 : 0).interval_ms;
+  portEXIT_CRITICAL(&g_scheduler_mux);
+  return interval_ms;
+}
+
+DisplayRateStats DisplayRate(bool secondary) {
+  DisplayRateStats out;
+  portENTER_CRITICAL(&g_scheduler_mux);
+  const FrameScheduler::Rate& r = g_scheduler.rate(secondary ? 1 : 0);
+  out.interval_ms = r.interval_ms;
+  out.transfer_us = r.transfer_us;
+  out.weight = r.weight;
+  portEXIT_CRITICAL(&g_scheduler_mux);
+  return out;
+}
+
+void DisplayStaggerInline(bool& allow_oled1, bool& allow_oled2, bool force_oled1) {
+  if (!allow_oled1 || !allow_oled2 || !BurstTooLong()) return;
+  if (force_oled1 || PickFirst() == 0) {
+    allow_oled2 = false;
+  } else {
+    allow_oled1 = false;  // defer OLED1 this tick
+  }
+}
+
+void DisplayRecordLoopBlocked(uint32_t blocked_us, uint32_t now_ms) {
+  g_block_sum_us += blocked_us;
+  if (blocked_us > g_block_max_us) g_block_max_us = blocked_us;
+  ++g_block_ticks;
+  if ((now_ms - g_block_window_ms) < 1000U) return;
+  g_block_last.avg_us = g_block_sum_us / g_block_ticks;
+  g_block_last.max_us = g_block_max_us;
+  g_block_last.ticks = g_block_ticks;
+  g_block_sum_us = 0;
+  g_block_max_us = 0;
+  g_block_ticks = 0;
+  g_block_window_ms = now_ms;
+}
+
+DisplayBlockStats DisplayLoopBlockStats() { return g_block_last; }
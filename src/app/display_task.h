@@ -0,0 +1,42 @@
+// OLED frame transfer task: the main loop renders, this task drives the bus.
+#pragma once
+
+#include <stdint.h>
+
+// With the task running, renderUi only copies each finished frame into the
+// display's back buffer (OledU8g2 async mode); the task streams it out over
+// I2C while the loop renders the next one. Frame pacing (FrameScheduler) and
+// the order of the two displays' transfers live here.
+void StartDisplayTask();
+bool DisplayTaskRunning();
+// Wakes the task after the loop submitted frames.
+void DisplayTaskKick();
+
+// Once per loop tick: folds the transfers measured since the last call into
+// the scheduler and recomputes both frame intervals. `urgent` marks a
+// display showing the focused or an alerting zone; CAN load shrinks the
+// bus-time budget.
+void DisplaySchedulerTick(bool primary_on, bool secondary_on, bool primary_urgent,
+                          bool secondary_urgent, bool can_load);
+// Minimum spacing between frames on a display (last DisplaySchedulerTick).
+uint32_t DisplayFrameIntervalMs(bool secondary);
+// Interval, mean transfer time and share weight, for telemetry.
+struct DisplayRateStats {
+  uint32_t interval_ms = 0;
+  uint32_t transfer_us = 0;
+  uint8_t weight = 0;
+};
+DisplayRateStats DisplayRate(bool secondary);
+// Inline-send fallback (task not running): never put both frames on the bus
+// in one tick when together they would block the loop too long.
+void DisplayStaggerInline(bool& allow_oled1, bool& allow_oled2, bool force_oled1);
+
+// Main-loop time blocked in frame sends per render tick, over the last
+// completed second.
+struct DisplayBlockStats {
+  uint32_t avg_us = 0;
+  uint32_t max_us = 0;
+  uint32_t ticks = 0;
+};
+void DisplayRecordLoopBlocked(uint32_t blocked_us, uint32_t now_ms);
+DisplayBlockStats DisplayLoopBlockStats();
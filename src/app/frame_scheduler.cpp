@@ -0,0 +1,79 @@
+#include "app/frame_scheduler.h"
+
+namespace {
+
+// A full 128x32 frame: 512 pixel bytes, ~9 bus bits per byte.
+constexpr uint32_t kFullFrameBits = 512U * 9U;
+
+}  // namespace
+
+void FrameScheduler::setBusClock(uint8_t display, uint32_t bus_hz) {
+  if (display >= kDisplays || measured_[display] || bus_hz == 0) return;
+  rates_[display].transfer_us =
+      static_cast<uint32_t>((static_cast<uint64_t>(kFullFrameBits) * 1000000U) / bus_hz);
+}
+
+void FrameScheduler::recordTransfers(uint8_t display, uint32_t frames, uint32_t transfer_us,
+                                     uint32_t unchanged) {
+  if (display >= kDisplays || frames == 0) return;
+  if (unchanged > frames) unchanged = frames;
+  Rate& r = rates_[display];
+  // Unchanged frames put nothing on the bus; averaging them in as 0 us would
+  // make a mostly static display look cheap the moment it starts changing.
+  const uint32_t transferred = frames - unchanged;
+  if (transferred > 0) {
+    const uint32_t mean_us = transfer_us / transferred;
+    if (!measured_[display]) {
+      r.transfer_us = mean_us;
+      measured_[display] = true;
+    } else {
+      // EMA, 1/4 per sample batch.
+      const int32_t delta = static_cast<int32_t>(mean_us - r.transfer_us);
+      r.transfer_us = static_cast<uint32_t>(static_cast<int32_t>(r.transfer_us) + delta / 4);
+    }
+  }
+  uint8_t& run = unchanged_run_[display];
+  if (unchanged < frames) {
+    run = 0;
+  } else {
+    run = (run + frames > 255U) ? 255 : static_cast<uint8_t>(run + frames);
+  }
+  r.changing = run < kIdleAfterFrames;
+}
+
+void FrameScheduler::update(const bool active[kDisplays], const bool urgent[kDisplays],
+                            uint8_t budget_pct) {
+  if (budget_pct == 0) budget_pct = 1;
+  uint32_t total_weight = 0;
+  for (uint8_t d = 0; d < kDisplays; ++d) {
+    Rate& r = rates_[d];
+    r.weight = active[d] ? static_cast<uint8_t>(1 + (r.changing ? 1 : 0) + (urgent[d] ? 2 : 0))
+                         : 0;
+    total_weight += r.weight;
+  }
+  for (uint8_t d = 0; d < kDisplays; ++d) {
+    Rate& r = rates_[d];
+    if (r.weight == 0) continue;
+    // transfer / (share * budget), in ms, rounded up.
+    const uint64_t den = static_cast<uint64_t>(r.weight) * budget_pct * 1000U;
+    uint32_t target = static_cast<uint32_t>(
+        (static_cast<uint64_t>(r.transfer_us) * total_weight * 100U + den - 1) / den);
+    if (!r.changing && !urgent[d] && target < kIdleIntervalMs) target = kIdleIntervalMs;
+    if (target < kMinIntervalMs) target = kMinIntervalMs;
+    if (target > kMaxIntervalMs) target = kMaxIntervalMs;
+    // Slow down at once to stay in budget; speed up only on a clear gain so
+    // the rate does not hunt with every partial-frame size.
+    if (target > r.interval_ms || target < r.interval_ms - r.interval_ms / 8) {
+      r.interval_ms = target;
+    }
+  }
+}
+
+uint8_t FrameScheduler::pickFirst() {
+  if (rates_[0].weight != rates_[1].weight) {
+    return rates_[0].weight > rates_[1].weight ? 0 : 1;
+  }
+  const uint8_t first = prefer_primary_ ? 0 : 1;
+  prefer_primary_ = !prefer_primary_;
+  return first;
+}
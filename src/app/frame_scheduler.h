@@ -0,0 +1,51 @@
+#pragma once
+
+#include <stdint.h>
+
+// Frame pacing for the two OLEDs from measured transfer time. Both displays'
+// transfers are serialized (one display task, and the software bus is
+// bit-banged on the CPU), so they share one bus-time budget: the fraction of
+// wall time spent streaming frames. Each display gets a weighted share of
+// it; a display showing the focused or an alerting zone weighs more, one
+// whose frames keep changing weighs more than one whose frames come out
+// unchanged. The interval is the display's mean transfer time divided by its
+// share, so the frame rate is as high as the wiring allows within budget.
+class FrameScheduler {
+ public:
+  static constexpr uint8_t kDisplays = 2;
+  static constexpr uint32_t kMinIntervalMs = 40;   // 25 fps cap
+  static constexpr uint32_t kMaxIntervalMs = 500;
+  // Static content still refreshes (blink, stale transitions), but slower.
+  static constexpr uint32_t kIdleIntervalMs = 125;
+  // Unchanged transfers in a row before a display counts as static.
+  static constexpr uint8_t kIdleAfterFrames = 4;
+
+  struct Rate {
+    uint32_t interval_ms = kIdleIntervalMs;
+    uint32_t transfer_us = 0;  // mean per frame that changed tiles
+    uint8_t weight = 0;
+    bool changing = false;
+  };
+
+  // Seeds the transfer estimate (one full 128x32 frame at `bus_hz`) until
+  // the first measurement arrives.
+  void setBusClock(uint8_t display, uint32_t bus_hz);
+  // `frames` transfers took `transfer_us` in total; `unchanged` of them had
+  // no changed tiles and only count towards the idle run, not the mean.
+  void recordTransfers(uint8_t display, uint32_t frames, uint32_t transfer_us,
+                       uint32_t unchanged);
+  // Recomputes both intervals. Inactive displays take no share;
+  // `budget_pct` is the share of wall time transfers may use.
+  void update(const bool active[kDisplays], const bool urgent[kDisplays], uint8_t budget_pct);
+
+  const Rate& rate(uint8_t display) const { return rates_[display]; }
+  // Which display goes first when both have a frame ready: the heavier one,
+  // alternating on a tie.
+  uint8_t pickFirst();
+
+ private:
+  Rate rates_[kDisplays];
+  bool measured_[kDisplays] = {};
+  uint8_t unchanged_run_[kDisplays] = {};
+  bool prefer_primary_ = true;
+};
@@ -430,12 +430,12 @@ void InputRuntimeTick(uint32_t now_ms) {
         }
         if (toggle_hide_page) {
           const uint8_t page = g_state.page_index[focus] % kPageCount;
-          const uint32_t page_mask = PageMaskAll(kPageCount);
-          const uint32_t bit = static_cast<uint32_t>(1U << page);
+          const PageMask page_mask = PageMask::All(kPageCount);
           bool applied = false;
           WithStateLock([&]() {
-            const uint32_t new_mask = g_state.page_hidden_mask ^ bit;
-            if (new_mask != page_mask) {  // prevent hiding all pages
+            PageMask new_mask = g_state.page_hidden_mask;
+            new_mask.flip(page);
+            if (!new_mask.covers(page_mask)) {  // prevent hiding all pages
               g_state.page_hidden_mask = new_mask;
               EnsureVisiblePages(g_state);
               if (IsPageHidden(g_state, page)) {
@@ -452,7 +452,7 @@ void InputRuntimeTick(uint32_t now_ms) {
         }
         if (unhide_all_pages) {
           WithStateLock([&]() {
-            g_state.page_hidden_mask = 0;
+            g_state.page_hidden_mask.clear();
             EnsureVisiblePages(g_state);
           });
           UiPersist ui = BuildUiPersistFromState(g_state);
@@ -515,8 +515,10 @@ void InputRuntimeTick(uint32_t now_ms) {
                                             : g_state.thresholds[cur_page].min;
           if (isnan(canon_seed)) {
             float live_val = NAN;
+            SignalSnapshot snap;
+            ActiveStore().snapshot(kAllSignalsMask, snap, now_ms);
             if (PageCanonicalValue(currentPageId(g_state, focus), g_state,
-                                   DisplayConfigForZone(g_state, focus), ActiveStore(),
+                                   DisplayConfigForZone(g_state, focus), snap,
                                    now_ms, live_val) &&
                 !isnan(live_val)) {
               canon_seed = live_val;
@@ -2,6 +2,11 @@
 
 #include <stdint.h>
 
+// Upper bound for per-page bitsets. Masks are stored as packed 32-bit words,
+// so raising this only costs 4 bytes per mask per extra 32 pages.
+constexpr uint8_t kMaxPages = 64;
+
+// Legacy 32-bit helper (NVS keys and portal forms still carry word 0 this way).
 constexpr uint32_t PageMaskAll(uint8_t page_count) {
   return (page_count >= 32u) ? 0xFFFFFFFFu
                              : static_cast<uint32_t>((1u << page_count) - 1u);
@@ -10,3 +15,75 @@ constexpr uint32_t PageMaskAll(uint8_t page_count) {
 constexpr bool IsValidPageIndex(uint8_t idx, uint8_t page_count) {
   return idx < page_count;
 }
+
+// Compact per-page bitset (units / alert / hidden flags). Out-of-range
+// indices read as false and are ignored on write.
+class PageMask {
+ public:
+  static constexpr uint8_t kWords = (kMaxPages + 31u) / 32u;
+
+  PageMask() { clear(); }
+
+  static PageMask All(uint8_t page_count) {
+    PageMask m;
+    for (uint8_t w = 0; w < kWords; ++w) {
+      const uint8_t base = static_cast<uint8_t>(w * 32u);
+      m.words_[w] = (page_count > base)
+                        ? PageMaskAll(static_cast<uint8_t>(page_count - base))
+                        : 0u;
+    }
+    return m;
+  }
+
+  bool test(uint8_t idx) const {
+    if (idx >= kMaxPages) return false;
+    return (words_[idx >> 5] & (1u << (idx & 31u))) != 0;
+  }
+  void set(uint8_t idx, bool on = true) {
+    if (idx >= kMaxPages) return;
+    const uint32_t bit = 1u << (idx & 31u);
+    if (on) {
+      words_[idx >> 5] |= bit;
+    } else {
+      words_[idx >> 5] &= ~bit;
+    }
+  }
+  void flip(uint8_t idx) { set(idx, !test(idx)); }
+  void clear() {
+    for (uint8_t w = 0; w < kWords; ++w) words_[w] = 0;
+  }
+  bool none() const {
+    for (uint8_t w = 0; w < kWords; ++w) {
+      if (words_[w] != 0) return false;
+    }
+    return true;
+  }
+  // True when every bit of `other` is also set here.
+  bool covers(const PageMask& other) const {
+    for (uint8_t w = 0; w < kWords; ++w) {
+      if ((words_[w] & other.words_[w]) != other.words_[w]) return false;
+    }
+    return true;
+  }
+
+  uint32_t word(uint8_t w) const { return (w < kWords) ? words_[w] : 0u; }
+  void setWord(uint8_t w, uint32_t v) {
+    if (w < kWords) words_[w] = v;
+  }
+
+  PageMask operator&(const PageMask& o) const {
+    PageMask r;
+    for (uint8_t w = 0; w < kWords; ++w) r.words_[w] = words_[w] & o.words_[w];
+    return r;
+  }
+  bool operator==(const PageMask& o) const {
+    for (uint8_t w = 0; w < kWords; ++w) {
+      if (words_[w] != o.words_[w]) return false;
+    }
+    return true;
+  }
+  bool operator!=(const PageMask& o) const { return !(*this == o); }
+
+ private:
+  uint32_t words_[kWords];
+};
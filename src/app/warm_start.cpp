@@ -0,0 +1,174 @@
+#include "app/warm_start.h"
+
+#include <Arduino.h>
+#include <esp_attr.h>
+#include <esp_ota_ops.h>
+#include <esp_system.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "app/app_globals.h"
+#include "config/logging.h"
+#include "data/signal_registry.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/portmacro.h"
+
+namespace {
+
+constexpr uint32_t kImageMagic = 0x57524D32;  // "WRM2"
+constexpr uint32_t kCaptureIntervalMs = 250;
+constexpr size_t kRetainedCount = static_cast<size_t>(SignalId::kCount);
+
+struct WarmImage {
+  uint32_t magic;
+  uint16_t size;
+  // Layout of the build that wrote the image: value[] is indexed by SignalId,
+  // so an image from other firmware may hold its values in different slots.
+  uint32_t build_key;       // CRC32 of the app ELF SHA-256
+  uint16_t signal_count;    // SignalId::kCount
+  uint16_t registry_count;  // SignalRegistry size, profile channels included
+  uint8_t page_index[kMaxZones];
+  uint8_t focus_zone;
+  uint32_t bitrate;  // rate the values below were decoded at
+  SignalMask mask;   // which value[] entries hold a live reading
+  float value[kRetainedCount];
+  uint32_t crc;  // over every byte above
+};
+
+// Not zeroed by the startup code; survives every reset but power-on (where
+// the CRC rejects whatever the RAM powered up with).
+RTC_NOINIT_ATTR WarmImage g_image;
+
+bool g_warm = false;
+uint32_t g_first_live_ms = 0;
+uint32_t g_last_capture_ms = 0;
+
+uint32_t Crc32(const uint8_t* data, size_t len) {
+  uint32_t crc = 0xFFFFFFFFu;
+  for (size_t i = 0; i < len; ++i) {
+    crc ^= data[i];
+    for (uint8_t b = 0; b < 8; ++b) {
+      crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+    }
+  }
+  return ~crc;
+}
+
+uint32_t ImageCrc(const WarmImage& img) {
+  return Crc32(reinterpret_cast<const uint8_t*>(&img), offsetof(WarmImage, crc));
+}
+
+uint32_t BuildKey() {
+  static uint32_t key = 0;
+  if (key == 0) {
+    const esp_app_desc_t* app = esp_ota_get_app_description();
+    key = Crc32(app->app_elf_sha256, sizeof(app->app_elf_sha256)) | 1u;
+  }
+  return key;
+}
+
+uint16_t RegistryCount() {
+  return static_cast<uint16_t>(SignalRegistry::instance().count());
+}
+
+bool ImageValid() {
+  return g_image.magic == kImageMagic && g_image.size == sizeof(WarmImage) &&
+         g_image.crc == ImageCrc(g_image) && g_image.build_key == BuildKey() &&
+         g_image.signal_count == kRetainedCount && g_image.registry_count == RegistryCount();
+}
+
+// Resets that interrupt a running gauge; a power-on or deep-sleep wake means
+// the retained readings are of unknown age.
+bool ResetKeepsImage(esp_reset_reason_t reason) {
+  switch (reason) {
+    case ESP_RST_SW:
+    case ESP_RST_PANIC:
+    case ESP_RST_INT_WDT:
+    case ESP_RST_TASK_WDT:
+    case ESP_RST_WDT:
+    case ESP_RST_BROWNOUT:
+    case ESP_RST_EXT:
+      return true;
+    default:
+      return false;
+  }
+}
+
+}  // namespace
+
+bool WarmStartRestore(AppState& state, DataStore& store, uint32_t now_ms) {
+  const esp_reset_reason_t reason = esp_reset_reason();
+  g_warm = ResetKeepsImage(reason) && ImageValid();
+  if (!g_warm) {
+    memset(&g_image, 0, sizeof(g_image));
+    return false;
+  }
+  SignalSample batch[kRetainedCount];
+  uint8_t count = 0;
+  for (size_t i = 0; i < kRetainedCount; ++i) {
+    if (!(g_image.mask & (1UL << i))) continue;
+    batch[count++] = SignalSample{static_cast<SignalId>(i), g_image.value[i]};
+    // Render paths fall back to last_good (shown with "!") while the store
+    // reports the signal stale.
+    state.last_good[i].value = g_image.value[i];
+    state.last_good[i].last_ok_ms = now_ms;
+    state.last_good[i].has_value = true;
+  }
+  store.restore(batch, count, now_ms);
+  for (uint8_t z = 0; z < kMaxZones; ++z) {
+    state.page_index[z] = static_cast<uint8_t>(g_image.page_index[z] % kPageCount);
+  }
+  state.focus_zone = g_image.focus_zone % GetActiveZoneCount(state);
+  if (g_image.bitrate != 0 && !state.can_bitrate_locked) {
+    // Frames were decoded at this rate moments ago: start there, locked for
+    // this session only (a bus-off unlocks it again), instead of scanning.
+    state.can_bitrate_value = g_image.bitrate;
+    state.can_bitrate_locked = true;
+  }
+  LOGI("[WARM] restored %u values, bitrate=%lu\r\n", static_cast<unsigned>(count),
+       static_cast<unsigned long>(g_image.bitrate));
+  return true;
+}
+
+void WarmStartTick(const AppState& state, const DataStore& store, uint32_t now_ms) {
+  if (state.demo_mode) return;
+  uint32_t rx_dash = 0;
+  portENTER_CRITICAL(&g_state_mux);
+  rx_dash = state.can_stats.rx_dash;
+  portEXIT_CRITICAL(&g_state_mux);
+  if (rx_dash == 0) return;
+  if (g_first_live_ms == 0) {
+    g_first_live_ms = now_ms ? now_ms : 1;
+    LOGI("[WARM] first live value %lums after reset (%s start)\r\n",
+         static_cast<unsigned long>(g_first_live_ms), g_warm ? "warm" : "cold");
+  }
+  if ((now_ms - g_last_capture_ms) < kCaptureIntervalMs) return;
+  g_last_capture_ms = now_ms;
+
+  SignalSnapshot snap;
+  store.snapshot(kAllSignalsMask, snap, now_ms);
+  const bool had_image = ImageValid();
+  SignalMask live = 0;
+  for (size_t i = 0; i < kRetainedCount; ++i) {
+    const SignalRead& r = snap.read[i];
+    if (!r.valid || (r.flags & (kFlagStale | kFlagInvalid | kFlagRetained))) continue;
+    g_image.value[i] = r.value;
+    live |= static_cast<SignalMask>(1UL << i);
+  }
+  if (live == 0) return;  // keep the last image through a CAN outage
+  // Signals not live right now keep their previous reading.
+  g_image.mask = (had_image ? g_image.mask : 0) | live;
+  g_image.magic = kImageMagic;
+  g_image.size = sizeof(WarmImage);
+  g_image.build_key = BuildKey();
+  g_image.signal_count = static_cast<uint16_t>(kRetainedCount);
+  g_image.registry_count = RegistryCount();
+  memcpy(g_image.page_index, state.page_index, sizeof(g_image.page_index));
+  g_image.focus_zone = state.focus_zone;
+  g_image.bitrate = state.can_bitrate_value;
+  g_image.crc = ImageCrc(g_image);
+}
+
+bool WarmStartWasWarm() { return g_warm; }
+
+uint32_t WarmStartFirstLiveMs() { return g_first_live_ms; }
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "app_state.h"
+#include "data/datastore.h"
+
+// Warm start across brownout / watchdog / panic / software resets: the last
+// live CAN values, the bitrate they arrived at and the selected pages are
+// kept in RTC memory (CRC-checked, and keyed to the firmware build and signal
+// layout so an image written before an OTA update is dropped). At boot they
+// are re-published as stale (DataStore::restore + last_good), so the first
+// frame shows the previous readings flagged "!" instead of blanks while CAN is
+// re-acquired.
+
+// Boot: after the UI/CAN settings load, before CAN start. True when a valid
+// image was restored.
+bool WarmStartRestore(AppState& state, DataStore& store, uint32_t now_ms);
+// Main loop: refreshes the image from live values (rate-limited) and records
+// the time from reset to the first decoded CAN value.
+void WarmStartTick(const AppState& state, const DataStore& store, uint32_t now_ms);
+
+bool WarmStartWasWarm();
+// ms since reset at which the first live CAN value landed; 0 until then.
+uint32_t WarmStartFirstLiveMs();
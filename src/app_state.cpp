@@ -94,6 +94,15 @@ void initDefaults(AppState& s) {
   strlcpy(s.user_sensor[1].label, "OILT", sizeof(s.user_sensor[1].label));
   s.user_sensor[1].scale = 1.0f;
   s.user_sensor[1].offset = 0.0f;
+  for (size_t i = 0; i < kSignalCount; ++i) {
+    s.signal_filter[i] = SignalFilterCfg{};
+  }
+  // Injector duty (%), AFR error, fuel flow (cc/min for 4 x 440 cc injectors).
+  static const char* const kDefaultDerived[kDerivedChannelCount] = {
+      "PW1*RPM/1200", "AFR1-AFRtg1", "PW1*RPM*440*4/120000"};
+  for (uint8_t i = 0; i < kDerivedChannelCount; ++i) {
+    strlcpy(s.derived[i].expr, kDefaultDerived[i], sizeof(s.derived[i].expr));
+  }
   s.stoich_afr = 14.7f;
   s.afr_show_lambda = false;
   for (size_t i = 0; i < kPageCount; ++i) {
@@ -115,11 +124,10 @@ void initDefaults(AppState& s) {
   s.btn_pressed = false;
   s.btn_pending_count = 0;
   s.allow_oled2_during_hold = false;
-  s.page_units_mask = 0;
-  const uint32_t all_disabled = 0;
-  s.page_alert_max_mask = all_disabled;
-  s.page_alert_min_mask = all_disabled;
-  s.page_hidden_mask = 0;
+  s.page_units_mask.clear();
+  s.page_alert_max_mask.clear();
+  s.page_alert_min_mask.clear();
+  s.page_hidden_mask.clear();
   for (uint8_t z = 0; z < kMaxZones; ++z) {
     s.boot_page_index[z] = s.page_index[z];
   }
@@ -200,44 +208,32 @@ static bool ZoneActive(const AppState& state, uint8_t z) {
 
 bool GetPageUnits(const AppState& state, uint8_t page_index) {
   if (page_index >= kPageCount) return false;
-  return (state.page_units_mask & (1U << page_index)) != 0;
+  return state.page_units_mask.test(page_index);
 }
 
 void SetPageUnits(AppState& state, uint8_t page_index, bool imperial) {
   if (page_index >= kPageCount) return;
-  if (imperial) {
-    state.page_units_mask |= static_cast<uint32_t>(1U << page_index);
-  } else {
-    state.page_units_mask &= static_cast<uint32_t>(~(1U << page_index));
-  }
+  state.page_units_mask.set(page_index, imperial);
 }
 
 bool GetPageMaxAlertEnabled(const AppState& state, uint8_t page_index) {
   if (page_index >= kPageCount) return false;
-  return (state.page_alert_max_mask & (1U << page_index)) != 0;
+  return state.page_alert_max_mask.test(page_index);
 }
 
 void SetPageMaxAlertEnabled(AppState& state, uint8_t page_index, bool enabled) {
   if (page_index >= kPageCount) return;
-  if (enabled) {
-    state.page_alert_max_mask |= static_cast<uint32_t>(1U << page_index);
-  } else {
-    state.page_alert_max_mask &= static_cast<uint32_t>(~(1U << page_index));
-  }
+  state.page_alert_max_mask.set(page_index, enabled);
 }
 
 bool GetPageMinAlertEnabled(const AppState& state, uint8_t page_index) {
   if (page_index >= kPageCount) return false;
-  return (state.page_alert_min_mask & (1U << page_index)) != 0;
+  return state.page_alert_min_mask.test(page_index);
 }
 
 void SetPageMinAlertEnabled(AppState& state, uint8_t page_index, bool enabled) {
   if (page_index >= kPageCount) return;
-  if (enabled) {
-    state.page_alert_min_mask |= static_cast<uint32_t>(1U << page_index);
-  } else {
-    state.page_alert_min_mask &= static_cast<uint32_t>(~(1U << page_index));
-  }
+  state.page_alert_min_mask.set(page_index, enabled);
 }
 
 ScreenSettings& DisplayConfigForDisplay(AppState& state, PhysicalDisplayId disp) {
@@ -307,7 +303,7 @@ uint8_t UiUserZoneToInternal(DisplayTopology topo, uint8_t user_zone) {
 
 bool IsPageHidden(const AppState& s, uint8_t page) {
   if (page >= kPageCount) return false;
-  return (s.page_hidden_mask & (1U << page)) != 0;
+  return s.page_hidden_mask.test(page);
 }
 
 uint8_t FirstVisiblePage(const AppState& s) {
@@ -327,9 +323,8 @@ uint8_t NextVisiblePage(const AppState& s, uint8_t cur, int dir) {
 }
 
 void EnsureVisiblePages(AppState& s) {
-  const uint32_t all_mask = PageMaskAll(kPageCount);
-  if ((s.page_hidden_mask & all_mask) == all_mask) {
-    s.page_hidden_mask = 0;
+  if (s.page_hidden_mask.covers(PageMask::All(kPageCount))) {
+    s.page_hidden_mask.clear();
   }
   for (uint8_t z = 0; z < kMaxZones; ++z) {
     if (s.boot_page_index[z] >= kPageCount) {
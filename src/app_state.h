@@ -3,12 +3,16 @@
 #include <Arduino.h>
 
 #include "app_config.h"
+#include "app/page_mask.h"
 #include "ui_menu.h"
 #include "data/datastore.h"
+#include "data/derived_channels.h"
+#include "data/signal_contract.h"
+#include "data/signal_filter.h"
 
 constexpr uint8_t kMaxZones = 3;
 constexpr uint8_t kPageCount = 21;
-static_assert(kPageCount <= 32, "kPageCount too large for 32-bit masks");
+static_assert(kPageCount <= kMaxPages, "kPageCount too large for PageMask");
 static_assert(kMaxZones <= 32, "kMaxZones too large for 32-bit masks");
 
 struct MockDataStore {
@@ -42,6 +46,10 @@ struct RenderState {
   bool last_focused = false;
   bool last_exclam_phase = false;
   bool last_lock_toast = false;
+  // Hash of everything the last drawn frame showed (0: unknown) and the
+  // display's frame epoch once it was sent.
+  uint32_t last_fingerprint = 0;
+  uint32_t last_epoch = 0;
 };
 
 struct Thresholds {
@@ -101,7 +109,13 @@ enum class UserSensorKind : uint8_t {
   kUnitless
 };
 
-enum class UserSensorSource : uint8_t { kSensor1 = 0, kSensor2 };
+enum class UserSensorSource : uint8_t {
+  kSensor1 = 0,
+  kSensor2,
+  kDerived1,  // derived channels (AppState::derived)
+  kDerived2,
+  kDerived3
+};
 
 struct UserSensorCfg {
   UserSensorPreset preset = UserSensorPreset::kOilPressure;
@@ -199,7 +213,8 @@ struct AppState {
     uint32_t err_passive = 0;
     uint32_t rx_overrun = 0;
     uint32_t rx_missed = 0;
-    uint32_t decode_oob = 0;  // out-of-range rejects
+    uint32_t decode_oob = 0;  // rejected signals (one per out-of-range value, not per frame)
+    uint32_t decode_repeat = 0;  // identical payloads replayed from DecodeCache
   } can_stats;
   // CAN RX task writes; UI reads via snapshot.
   uint32_t last_bus_off_ms = 0;
@@ -247,6 +262,10 @@ struct AppState {
     char temp_label[8] = "OilT";
   } oil_cfg;
   UserSensorCfg user_sensor[2];
+  // Ingest smoothing per SignalId; persisted with the user sensors.
+  SignalFilterCfg signal_filter[kSignalCount];
+  // Expressions behind SignalId::kDerived1..3; persisted separately.
+  DerivedChannelCfg derived[kDerivedChannelCount];
   float stoich_afr = 14.7f;
   bool afr_show_lambda = false;
 
@@ -263,10 +282,10 @@ struct AppState {
     uint32_t oil_writes = 0;
     uint32_t oil_write_max_ms = 0;
   } persist_audit;
-  uint32_t page_units_mask = 0;  // bit=1 => imperial, 0 => metric
-  uint32_t page_alert_max_mask = 0;  // bit=1 => MAX alert enabled
-  uint32_t page_alert_min_mask = 0;  // bit=1 => MIN alert enabled
-  uint32_t page_hidden_mask = 0;  // bit=1 => page hidden
+  PageMask page_units_mask;  // bit=1 => imperial, 0 => metric
+  PageMask page_alert_max_mask;  // bit=1 => MAX alert enabled
+  PageMask page_alert_min_mask;  // bit=1 => MIN alert enabled
+  PageMask page_hidden_mask;  // bit=1 => page hidden
   enum class LockToast : uint8_t { kNone = 0, kLocked, kUnlocked, kBlocked };
   LockToast lock_toast_type[kMaxZones] = {LockToast::kNone, LockToast::kNone,
                                           LockToast::kNone};
@@ -1,90 +1,381 @@
 #include "data/datastore.h"
+
+#include <math.h>
+#include <new>
+
+#include "data/derived_channels.h"
+#include "data/signal_aggregates.h"
 #include "data/signal_contract.h"
+#include "data/signal_filter.h"
+#include "data/signal_health.h"
+#include "data/signal_history.h"
+#include "data/signal_registry.h"
+
+namespace {
+
+uint16_t ClampWindowMs(uint32_t ms) {
+  return (ms > 0xFFFFu) ? static_cast<uint16_t>(0xFFFFu) : static_cast<uint16_t>(ms);
+}
+
+struct DerivedInputCtx {
+  const DataStore* store;
+  uint32_t now_ms;
+};
+
+}  // namespace
+
+// Writer: odd store, release fence, payload, release store of the even value.
+// Reader: acquire load, payload copy, acquire fence, relaxed reload. The
+// fences keep the payload accesses inside the two counter accesses on both
+// sides (plain volatile counters did not order the payload on their own).
+void DataStore::writeBegin() {
+  const uint32_t s = __atomic_load_n(&seq_, __ATOMIC_RELAXED);
+  __atomic_store_n(&seq_, s + 1, __ATOMIC_RELAXED);
+  __atomic_thread_fence(__ATOMIC_RELEASE);
+}
+
+void DataStore::writeEnd() {
+  const uint32_t s = __atomic_load_n(&seq_, __ATOMIC_RELAXED);
+  __atomic_store_n(&seq_, s + 1, __ATOMIC_RELEASE);
+}
+
+template <typename Fn>
+void DataStore::readConsistent(Fn&& copy) const {
+  for (;;) {
+    const uint32_t seq_begin = __atomic_load_n(&seq_, __ATOMIC_ACQUIRE);
+    if (seq_begin & 0x1U) continue;  // writer in progress
+    copy();
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    if (__atomic_load_n(&seq_, __ATOMIC_RELAXED) == seq_begin) return;
+#ifdef UNIT_TEST
+    __atomic_fetch_add(&debug_retries_, 1, __ATOMIC_RELAXED);
+#endif
+  }
+}
+
+DataStore::DataStore()
+    : slots_(nullptr),
+      count_(0),
+      history_(nullptr),
+      aggregates_(nullptr),
+      health_(nullptr),
+      filters_(nullptr),
+      derived_(nullptr),
+      subs_(),
+      sub_count_(0),
+      seq_(0) {
+  resize(SignalRegistry::instance().count());
+}
+
+DataStore::~DataStore() { delete[] slots_; }
+
+bool DataStore::resize(size_t count) {
+  if (count != count_ || !slots_) {
+    Slot* fresh = new (std::nothrow) Slot[count];
+    if (!fresh) {
+      return false;
+    }
+    delete[] slots_;
+    slots_ = fresh;
+    count_ = count;
+  }
+  clear();
+  return true;
+}
+
+void DataStore::clear() {
+  writeBegin();
+  for (size_t i = 0; i < count_; ++i) {
+    Slot& s = slots_[i];
+    s.value = 0.0f;
+    s.raw = 0.0f;
+    const SignalContractEntry* ent = LookupSignalContract(static_cast<SignalId>(i));
+    s.deadband = ent ? ent->deadband : 0.0f;
+    s.ts_ms = 0;
+    s.invalid_until_ms = 0;
+    s.stale_ms = kDefaultStaleMs;
+    s.expire_ms = kDefaultExpireMs;
+    s.flags = 0;
+  }
+  if (history_) history_->clear();
+  if (aggregates_) aggregates_->clear();
+  if (health_) health_->clear();
+  if (filters_) filters_->clear();
+  writeEnd();
+}
 
-DataStore::DataStore() {
-  for (size_t i = 0; i < static_cast<size_t>(SignalId::kCount); ++i) {
-    invalid_until_ms_[i] = 0;
-    seq_[i] = 0;
+bool DataStore::writeValue(size_t idx, float phys, uint32_t now_ms,
+                           uint8_t flags) {
+  ValidateSignalContract(static_cast<SignalId>(idx), phys);
+  Slot& slot = slots_[idx];
+  if (health_) {
+    health_->recordAccepted(static_cast<SignalId>(idx), phys, slot.ts_ms,
+                            slot.stale_ms, now_ms);
   }
+  // Within the deadband of a fresh, unflagged value nothing visible moves;
+  // history/windows still see the sample so their time coverage holds. A
+  // filter that has not settled on its input still has to be fed (compared
+  // in the filter's fixed-point domain, not against the float input).
+  if (slot.deadband >= 0.0f && slot.ts_ms != 0 && flags == slot.flags &&
+      (!filters_ || filters_->settled(static_cast<SignalId>(idx))) &&
+      now_ms >= slot.invalid_until_ms && (now_ms - slot.ts_ms) <= slot.stale_ms &&
+      fabsf(phys - slot.raw) <= slot.deadband) {
+    slot.ts_ms = now_ms;
+    if (health_) health_->recordSuppressed(static_cast<SignalId>(idx));
+    if (history_) history_->record(static_cast<SignalId>(idx), phys, now_ms);
+    if (aggregates_) aggregates_->record(static_cast<SignalId>(idx), slot.value, now_ms);
+    return false;
+  }
+  setInvalidUntil(idx, 0, now_ms);
+  const float shown =
+      filters_ ? filters_->apply(static_cast<SignalId>(idx), phys, now_ms) : phys;
+  slot.value = shown;
+  slot.raw = phys;
+  slot.ts_ms = now_ms;
+  slot.flags = flags;
+  // History keeps raw samples (blip detection); extrema follow what is shown.
+  if (history_) history_->record(static_cast<SignalId>(idx), phys, now_ms);
+  if (aggregates_) aggregates_->record(static_cast<SignalId>(idx), shown, now_ms);
+  return true;
+}
+
+// Moves the invalid hold; the health table is credited with the change in
+// remaining hold time, so a hold cut short by a good sample is not counted.
+void DataStore::setInvalidUntil(size_t idx, uint32_t until_ms, uint32_t now_ms) {
+  Slot& slot = slots_[idx];
+  if (health_) {
+    const uint32_t before =
+        (now_ms < slot.invalid_until_ms) ? (slot.invalid_until_ms - now_ms) : 0;
+    const uint32_t after = (now_ms < until_ms) ? (until_ms - now_ms) : 0;
+    if (before != after) {
+      health_->addInvalidMs(static_cast<SignalId>(idx),
+                            static_cast<int32_t>(after - before));
+    }
+  }
+  slot.invalid_until_ms = until_ms;
 }
 
 void DataStore::update(SignalId id, float phys, uint32_t now_ms, uint8_t flags) {
   const size_t idx = static_cast<size_t>(id);
-  if (idx >= static_cast<size_t>(SignalId::kCount)) {
+  if (idx >= count_) {
     return;
   }
-  ValidateSignalContract(id, phys);
-  volatile uint32_t& seq = seq_[idx];
-  seq += 1;  // enter (odd)
-  values_[idx].value = phys;
-  values_[idx].ts_ms = now_ms;
-  values_[idx].flags = flags;
-  invalid_until_ms_[idx] = 0;
-  seq += 1;  // exit (even)
+  const SignalMask bit = (idx < 32) ? static_cast<SignalMask>(1UL << idx) : 0;
+  writeBegin();
+  const bool moved = writeValue(idx, phys, now_ms, flags);
+  SignalMask changed = moved ? bit : 0;
+  changed |= runDerived(changed, moved ? 0 : bit, now_ms);
+  writeEnd();
+  publish(changed);
 }
 
-SignalRead DataStore::get(SignalId id, uint32_t now_ms) const {
-  SignalRead out{};
-  const size_t idx = static_cast<size_t>(id);
-  if (idx >= static_cast<size_t>(SignalId::kCount)) {
-    return out;
+void DataStore::updateGroup(const SignalSample* batch, uint8_t count,
+                            uint32_t now_ms, uint32_t invalid_mask,
+                            uint32_t hold_ms) {
+  if (!batch || count == 0) {
+    return;
   }
-  for (;;) {
-    uint32_t seq_begin = seq_[idx];
-    if (seq_begin & 0x1U) continue;  // writer in progress
-    SignalValue v = values_[idx];
-    uint32_t invalid_until = invalid_until_ms_[idx];
-    uint32_t seq_end = seq_[idx];
-    if (seq_begin != seq_end || (seq_end & 0x1U)) {
-      continue;  // inconsistent read; retry
-    }
-
-    out.value = v.value;
-    out.valid = v.ts_ms != 0;
-    if (out.valid) {
-      uint32_t age = now_ms - v.ts_ms;  // unsigned: preserves wrap-around
-      if (now_ms < v.ts_ms) {
-        const uint32_t skew = v.ts_ms - now_ms;
-        if (skew <= 2000U) {
-          age = 0;
-        }
-      }
-      out.age_ms = age;
-    } else {
-      out.age_ms = 0xFFFFFFFFu;
+  SignalMask changed = 0;
+  SignalMask refreshed = 0;
+  writeBegin();
+  for (uint8_t i = 0; i < count; ++i) {
+    const size_t idx = static_cast<size_t>(batch[i].id);
+    if (idx >= count_) {
+      continue;
     }
-    out.flags = v.flags;
-    if (now_ms < invalid_until) {
-      out.valid = false;
-      out.flags |= kFlagInvalid;
-      return out;
+    const SignalMask bit = (idx < 32) ? static_cast<SignalMask>(1UL << idx) : 0;
+    if (i < 32 && (invalid_mask & (1UL << i))) {
+      if (health_) health_->recordRejected(batch[i].id, batch[i].phys, now_ms);
+      setInvalidUntil(idx, now_ms + hold_ms, now_ms);
+      changed |= bit;
+      continue;
     }
-    if (!out.valid) {
-      return out;
+    if (writeValue(idx, batch[i].phys, now_ms, 0)) {
+      changed |= bit;
+    } else {
+      refreshed |= bit;
     }
-    if (v.expire_ms > 0 && out.age_ms > v.expire_ms) {
-      out.valid = false;
-      out.flags |= kFlagStale;
-      return out;
+  }
+  changed |= runDerived(changed, refreshed & ~changed, now_ms);
+  writeEnd();
+  publish(changed);
+}
+
+bool DataStore::LoadDerivedInput(const void* ctx, SignalId id, float& out) {
+  const DerivedInputCtx* in = static_cast<const DerivedInputCtx*>(ctx);
+  const DataStore* ds = in->store;
+  const size_t idx = static_cast<size_t>(id);
+  if (idx >= ds->count_) return false;
+  // Unfiltered: smoothing is for display, not for values computed from it.
+  const SignalRead r = Evaluate(ds->slots_[idx], in->now_ms);
+  out = r.raw;
+  return r.valid && !(r.flags & kFlagStale);
+}
+
+// Writer side, inside the caller's sequence. Channels run in index order, so
+// a channel reading a lower-numbered one sees this update's result. Inputs
+// only `refreshed` (deadband) give the same result, which writeValue() in
+// turn treats as a freshness refresh.
+SignalMask DataStore::runDerived(SignalMask changed, SignalMask refreshed,
+                                 uint32_t now_ms) {
+  if (!derived_) return 0;
+  derived_->sync();
+  const DerivedInputCtx ctx{this, now_ms};
+  SignalMask written = 0;
+  for (uint8_t k = 0; k < kDerivedChannelCount; ++k) {
+    const SignalId id = DerivedSignal(k);
+    const size_t idx = static_cast<size_t>(id);
+    if (idx >= count_ || !(derived_->inputs(k) & (changed | refreshed | written))) {
+      continue;
     }
-    if (out.age_ms > v.stale_ms) {
-      out.flags |= kFlagStale;
+    float v = 0.0f;
+    if (!derived_->evaluate(k, &DataStore::LoadDerivedInput, &ctx, v)) continue;
+    if (writeValue(idx, v, now_ms, 0)) written |= SignalBit(id);
+  }
+  return written;
+}
+
+void DataStore::restore(const SignalSample* batch, uint8_t count, uint32_t now_ms) {
+  if (!batch || count == 0) {
+    return;
+  }
+  SignalMask changed = 0;
+  writeBegin();
+  for (uint8_t i = 0; i < count; ++i) {
+    const size_t idx = static_cast<size_t>(batch[i].id);
+    if (idx >= count_) continue;
+    Slot& slot = slots_[idx];
+    slot.value = batch[i].phys;
+    slot.raw = batch[i].phys;
+    slot.ts_ms = now_ms;
+    slot.flags = kFlagRetained;
+    if (idx < 32) changed |= static_cast<SignalMask>(1UL << idx);
+  }
+  writeEnd();
+  publish(changed);
+}
+
+SignalRead DataStore::Evaluate(const Slot& slot, uint32_t now_ms) {
+  SignalRead out{};
+  out.value = slot.value;
+  out.raw = slot.raw;
+  out.valid = slot.ts_ms != 0;
+  if (out.valid) {
+    uint32_t age = now_ms - slot.ts_ms;  // unsigned: preserves wrap-around
+    if (now_ms < slot.ts_ms) {
+      const uint32_t skew = slot.ts_ms - now_ms;
+      if (skew <= 2000U) {
+        age = 0;
+      }
     }
+    out.age_ms = age;
+  } else {
+    out.age_ms = 0xFFFFFFFFu;
+  }
+  out.flags = slot.flags;
+  if (now_ms < slot.invalid_until_ms) {
+    out.valid = false;
+    out.flags |= kFlagInvalid;
+    return out;
+  }
+  if (!out.valid) {
+    return out;
+  }
+  if (slot.flags & kFlagRetained) {
+    out.valid = false;
+    out.flags |= kFlagStale;
+    return out;
+  }
+  if (slot.expire_ms > 0 && out.age_ms > slot.expire_ms) {
+    out.valid = false;
+    out.flags |= kFlagStale;
     return out;
   }
+  if (out.age_ms > slot.stale_ms) {
+    out.flags |= kFlagStale;
+  }
+  return out;
+}
+
+SignalRead DataStore::get(SignalId id, uint32_t now_ms) const {
+  const size_t idx = static_cast<size_t>(id);
+  if (idx >= count_) {
+    return SignalRead{};
+  }
+  Slot copy;
+  readConsistent([&] { copy = slots_[idx]; });
+  return Evaluate(copy, now_ms);
+}
+
+void DataStore::snapshot(SignalMask mask, SignalSnapshot& out,
+                         uint32_t now_ms) const {
+  constexpr size_t kBuiltIn = static_cast<size_t>(SignalId::kCount);
+  const size_t limit = (count_ < kBuiltIn) ? count_ : kBuiltIn;
+  mask &= (limit >= 32) ? 0xFFFFFFFFu : static_cast<SignalMask>((1UL << limit) - 1UL);
+  Slot copy[kBuiltIn];
+  readConsistent([&] {  // one generation for every signal
+    for (size_t i = 0; i < limit; ++i) {
+      if (mask & (1UL << i)) copy[i] = slots_[i];
+    }
+  });
+  out.now_ms = now_ms;
+  out.mask = mask;
+  for (size_t i = 0; i < kBuiltIn; ++i) {
+    out.read[i] = (mask & (1UL << i)) ? Evaluate(copy[i], now_ms) : SignalRead{};
+  }
+}
+
+bool DataStore::readHistory(SignalId id, HistoryView& out) const {
+  if (!history_) return false;
+  bool ok = false;
+  readConsistent([&] { ok = history_->copy(id, out); });
+  return ok;
+}
+
+bool DataStore::readExtrema(SignalExtrema* out, size_t count) const {
+  if (!aggregates_ || !out) return false;
+  readConsistent([&] { aggregates_->readExtrema(out, count); });
+  return true;
+}
+
+bool DataStore::readWindow(SignalId id, uint32_t now_ms, WindowStats& out) const {
+  if (!aggregates_) return false;
+  bool ok = false;
+  readConsistent([&] { ok = aggregates_->readWindow(id, now_ms, out); });
+  return ok;
+}
+
+bool DataStore::readHealth(SignalHealthStats* out, size_t count,
+                           uint32_t now_ms) const {
+  if (!health_ || !out) return false;
+  readConsistent([&] { health_->read(out, count, now_ms); });
+  return true;
+}
+
+void DataStore::requestExtremaReset(bool reset_min, bool reset_max) {
+  if (aggregates_) aggregates_->requestReset(reset_min, reset_max);
 }
 
 void DataStore::setStaleMs(SignalId id, uint32_t stale_ms) {
   const size_t idx = static_cast<size_t>(id);
-  if (idx >= static_cast<size_t>(SignalId::kCount)) {
+  if (idx >= count_) {
+    return;
+  }
+  slots_[idx].stale_ms = ClampWindowMs(stale_ms);
+}
+
+void DataStore::setDeadband(SignalId id, float raw_units) {
+  const size_t idx = static_cast<size_t>(id);
+  if (idx >= count_) {
     return;
   }
-  values_[idx].stale_ms = stale_ms;
+  slots_[idx].deadband = raw_units;
 }
 
 void DataStore::setDefaultStale(uint32_t stale_ms) {
-  for (size_t i = 0; i < static_cast<size_t>(SignalId::kCount); ++i) {
-    values_[i].stale_ms = stale_ms;
+  const uint16_t clamped = ClampWindowMs(stale_ms);
+  for (size_t i = 0; i < count_; ++i) {
+    slots_[i].stale_ms = clamped;
   }
 }
 
@@ -98,11 +389,46 @@ void DataStore::setStaleForSignals(const SignalId* ids, uint8_t count,
 
 void DataStore::note_invalid(SignalId id, uint32_t now_ms, uint32_t hold_ms) {
   const size_t idx = static_cast<size_t>(id);
-  if (idx >= static_cast<size_t>(SignalId::kCount)) {
+  if (idx >= count_) {
     return;
   }
-  volatile uint32_t& seq = seq_[idx];
-  seq += 1;  // enter (odd)
-  invalid_until_ms_[idx] = now_ms + hold_ms;
-  seq += 1;  // exit (even)
+  writeBegin();
+  setInvalidUntil(idx, now_ms + hold_ms, now_ms);
+  writeEnd();
+  if (idx < 32) publish(static_cast<SignalMask>(1UL << idx));
+}
+
+int8_t DataStore::subscribe(SignalMask mask, NotifyFn notify, void* ctx) {
+  if (sub_count_ >= kMaxSubscribers) {
+    return -1;
+  }
+  Subscriber& s = subs_[sub_count_];
+  s.mask = mask;
+  s.dirty = 0;
+  s.notify = notify;
+  s.ctx = ctx;
+  return static_cast<int8_t>(sub_count_++);
+}
+
+void DataStore::setSubscriptionMask(int8_t sub, SignalMask mask) {
+  if (sub < 0 || sub >= static_cast<int8_t>(sub_count_)) return;
+  __atomic_store_n(&subs_[sub].mask, mask, __ATOMIC_RELAXED);
+}
+
+SignalMask DataStore::takeDirty(int8_t sub) {
+  if (sub < 0 || sub >= static_cast<int8_t>(sub_count_)) return 0;
+  return __atomic_exchange_n(&subs_[sub].dirty, 0, __ATOMIC_ACQ_REL);
+}
+
+void DataStore::publish(SignalMask changed) {
+  if (changed == 0) return;
+  for (uint8_t i = 0; i < sub_count_; ++i) {
+    Subscriber& s = subs_[i];
+    const SignalMask hit = changed & __atomic_load_n(&s.mask, __ATOMIC_RELAXED);
+    if (hit == 0) continue;
+    const SignalMask before = __atomic_fetch_or(&s.dirty, hit, __ATOMIC_ACQ_REL);
+    if (before == 0 && s.notify) {
+      s.notify(s.ctx);
+    }
+  }
 }
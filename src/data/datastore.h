@@ -24,47 +24,200 @@ enum class SignalId : uint8_t {
   kLaunchTiming,
   kTcRetard,
   kVss1,
+  kDerived1,  // virtual: written by DerivedChannels, never decoded
+  kDerived2,
+  kDerived3,
   kCount
 };
 
+class DerivedChannels;
+class HistoryView;
+class SignalAggregates;
+class SignalFilters;
+class SignalHealth;
+class SignalHistory;
+struct SignalExtrema;
+struct SignalHealthStats;
+struct WindowStats;
+
 constexpr uint8_t kFlagStale = 0x01;
 constexpr uint8_t kFlagInvalid = 0x02;
-
-struct SignalValue {
-  float value = 0.0f;
-  uint32_t ts_ms = 0;
-  uint32_t stale_ms = 500;
-  uint32_t expire_ms = 5000;
-  uint8_t flags = 0;
-};
+constexpr uint8_t kFlagRetained = 0x04;  // carried over a reset, not yet live
 
 struct SignalRead {
-  float value = 0.0f;
+  float value = 0.0f;  // filtered when the signal has a smoothing filter
+  float raw = 0.0f;    // as decoded
   bool valid = false;
   uint32_t age_ms = 0;
   uint8_t flags = 0;
 };
 
+// One decoded value; a CAN frame decodes to a small batch of these.
+struct SignalSample {
+  SignalId id;
+  float phys;
+};
+
+// Bitmask over the built-in SignalIds (bit n == SignalId n).
+using SignalMask = uint32_t;
+static_assert(static_cast<size_t>(SignalId::kCount) <= 32,
+              "SignalMask holds one bit per built-in signal");
+
+constexpr SignalMask SignalBit(SignalId id) {
+  return static_cast<SignalMask>(1UL << static_cast<uint8_t>(id));
+}
+constexpr SignalMask kAllSignalsMask = static_cast<SignalMask>(
+    (1UL << static_cast<uint8_t>(SignalId::kCount)) - 1UL);
+
+// Frame-coherent copy of built-in signals, taken with DataStore::snapshot().
+// Signals outside `mask` read as never-received.
+struct SignalSnapshot {
+  uint32_t now_ms = 0;
+  SignalMask mask = 0;
+  SignalRead read[static_cast<size_t>(SignalId::kCount)];
+
+  SignalRead get(SignalId id) const {
+    const size_t idx = static_cast<size_t>(id);
+    if (idx >= static_cast<size_t>(SignalId::kCount) || !(mask & SignalBit(id))) {
+      SignalRead none{};
+      none.age_ms = 0xFFFFFFFFu;
+      return none;
+    }
+    return read[idx];
+  }
+};
+
+// Seqlocked signal values. Storage is one contiguous block sized from the
+// SignalRegistry (built-ins + profile channels); call resize() at boot after
+// profiles declare their channels and before any task touches the store.
+// A single store-wide sequence covers every slot, so a decoded message written
+// with updateGroup() is observed by snapshot() either entirely or not at all.
 class DataStore {
  public:
   DataStore();
+  ~DataStore();
+  DataStore(const DataStore&) = delete;
+  DataStore& operator=(const DataStore&) = delete;
+
+  // Reallocates for `count` signals and resets every slot. Boot-time only.
+  bool resize(size_t count);
+  // Resets every slot to defaults (values, stale/expire windows, invalid holds).
+  void clear();
+  size_t size() const { return count_; }
 
   void update(SignalId id, float phys, uint32_t now_ms, uint8_t flags = 0);
+  // Writes one decoded message under a single sequence bump. Entries whose bit
+  // is set in `invalid_mask` get the note_invalid() hold instead of a value.
+  void updateGroup(const SignalSample* batch, uint8_t count, uint32_t now_ms,
+                   uint32_t invalid_mask = 0, uint32_t hold_ms = 1500);
+  // Boot-time warm start: re-publishes values retained across a reset. They
+  // read as stale and not valid (value still carried) until a real sample
+  // for the signal arrives; nothing is recorded to history/aggregates/health.
+  void restore(const SignalSample* batch, uint8_t count, uint32_t now_ms);
   SignalRead get(SignalId id, uint32_t now_ms) const;
+  // Copies every signal in `mask` from the same write generation.
+  void snapshot(SignalMask mask, SignalSnapshot& out, uint32_t now_ms) const;
+  // Boot-time: accepted values of tracked signals are also appended to
+  // `history`, inside the same sequence as the value write.
+  void attachHistory(SignalHistory* history) { history_ = history; }
+  // Newest-first copy of a tracked signal; false when it has no history.
+  bool readHistory(SignalId id, HistoryView& out) const;
+  // Boot-time: streaming extrema / windows, fed like the history.
+  void attachAggregates(SignalAggregates* aggregates) { aggregates_ = aggregates; }
+  // Extrema for built-in ids [0, count) in one consistent pass.
+  bool readExtrema(SignalExtrema* out, size_t count) const;
+  bool readWindow(SignalId id, uint32_t now_ms, WindowStats& out) const;
+  // Restarts extrema at the next sample of each signal. Any task.
+  void requestExtremaReset(bool reset_min, bool reset_max);
+  // Boot-time: smoothing filters; `value` reads filtered, `raw` unfiltered.
+  // Filtering is for display: derived channels (and alerts) use `raw`.
+  void attachFilters(SignalFilters* filters) { filters_ = filters; }
+  // Boot-time: derived channels, re-evaluated inside the write sequence of any
+  // update that touches one of their inputs.
+  void attachDerived(DerivedChannels* derived) { derived_ = derived; }
+  // Boot-time: per-signal ingest telemetry (rates, rejects, invalid holds).
+  void attachHealth(SignalHealth* health) { health_ = health; }
+  bool readHealth(SignalHealthStats* out, size_t count, uint32_t now_ms) const;
+
+  // Change notifications. A subscriber owns a dirty bitset; writes to signals
+  // in its mask set their bits, and `notify(ctx)` fires on the clean -> dirty
+  // transition (from the writer's task), e.g. to wake a blocked consumer.
+  // subscribe() is boot-time; setSubscriptionMask/takeDirty are safe anytime.
+  using NotifyFn = void (*)(void* ctx);
+  static constexpr uint8_t kMaxSubscribers = 4;
+  int8_t subscribe(SignalMask mask, NotifyFn notify = nullptr,
+                   void* ctx = nullptr);
+  void setSubscriptionMask(int8_t sub, SignalMask mask);
+  // Returns and clears the signals changed since the previous call.
+  SignalMask takeDirty(int8_t sub);
   void setStaleMs(SignalId id, uint32_t stale_ms);
   void setStaleForSignals(const SignalId* ids, uint8_t count,
                           uint32_t stale_ms);
   void setDefaultStale(uint32_t stale_ms);
+  // Raw-unit deadband (defaults from the signal contract on clear()). A sample
+  // within it of the stored raw value refreshes freshness only: value, filters
+  // and derived channels are left alone and subscribers are not notified.
+  // Negative disables; 0 suppresses exact repeats only.
+  void setDeadband(SignalId id, float raw_units);
   void note_invalid(SignalId id, uint32_t now_ms, uint32_t hold_ms = 1500);
 #ifdef UNIT_TEST
   uint32_t debug_seq(SignalId id) const {
     const size_t idx = static_cast<size_t>(id);
-    return (idx < static_cast<size_t>(SignalId::kCount)) ? seq_[idx] : 0;
+    return (idx < count_) ? seq_ : 0;
+  }
+  // Reader passes that had to retry because a write overlapped them.
+  uint32_t debug_retries() const {
+    return __atomic_load_n(&debug_retries_, __ATOMIC_RELAXED);
   }
 #endif
 
  private:
-  SignalValue values_[static_cast<size_t>(SignalId::kCount)];
-  uint32_t invalid_until_ms_[static_cast<size_t>(SignalId::kCount)];
-  volatile uint32_t seq_[static_cast<size_t>(SignalId::kCount)];
+  // 28 bytes per signal; windows are u16 (stale/expire never exceed ~65 s).
+  struct Slot {
+    float value;
+    float raw;
+    float deadband;
+    uint32_t ts_ms;
+    uint32_t invalid_until_ms;
+    uint16_t stale_ms;
+    uint16_t expire_ms;
+    uint8_t flags;
+  };
+  static constexpr uint16_t kDefaultStaleMs = 500;
+  static constexpr uint16_t kDefaultExpireMs = 5000;
+
+  struct Subscriber {
+    SignalMask mask;   // atomic access only
+    SignalMask dirty;  // atomic access only
+    NotifyFn notify;
+    void* ctx;
+  };
+
+  static SignalRead Evaluate(const Slot& slot, uint32_t now_ms);
+  // False when the sample fell inside the deadband (freshness refresh only).
+  bool writeValue(size_t idx, float phys, uint32_t now_ms, uint8_t flags);
+  void setInvalidUntil(size_t idx, uint32_t until_ms, uint32_t now_ms);
+  void publish(SignalMask changed);
+  SignalMask runDerived(SignalMask changed, SignalMask refreshed, uint32_t now_ms);
+  static bool LoadDerivedInput(const void* ctx, SignalId id, float& out);
+  // Seqlock. Single writer per store; readers copy under readConsistent(),
+  // which repeats `copy` until no write overlapped it.
+  void writeBegin();
+  void writeEnd();
+  template <typename Fn>
+  void readConsistent(Fn&& copy) const;
+
+  Slot* slots_;
+  size_t count_;
+  SignalHistory* history_;
+  SignalAggregates* aggregates_;
+  SignalHealth* health_;
+  SignalFilters* filters_;
+  DerivedChannels* derived_;
+  Subscriber subs_[kMaxSubscribers];
+  uint8_t sub_count_;
+  uint32_t seq_;  // odd while a write is in progress; atomic access only
+#ifdef UNIT_TEST
+  mutable uint32_t debug_retries_ = 0;
+#endif
 };
@@ -0,0 +1,315 @@
+#include "data/derived_channels.h"
+
+#include <ctype.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "data/signal_contract.h"
+#include "data/signal_registry.h"
+
+namespace {
+
+// One byte per op; kOpConst/kOpSignal carry a one-byte operand.
+enum Op : uint8_t {
+  kOpConst = 1,
+  kOpSignal,
+  kOpAdd,
+  kOpSub,
+  kOpMul,
+  kOpDiv,
+  kOpNeg,
+};
+
+bool NameEquals(const char* ident, size_t len, const char* name) {
+  for (size_t i = 0; i < len; ++i) {
+    if (name[i] == '\0' ||
+        tolower(static_cast<unsigned char>(ident[i])) !=
+            tolower(static_cast<unsigned char>(name[i]))) {
+      return false;
+    }
+  }
+  return name[len] == '\0';
+}
+
+SignalId LookupSignalName(const char* ident, size_t len) {
+  for (size_t i = 0; i < kSignalCount; ++i) {
+    const SignalContractEntry* ent = LookupSignalContract(static_cast<SignalId>(i));
+    if (ent && NameEquals(ident, len, ent->name)) return ent->id;
+  }
+  return kInvalidSignalId;
+}
+
+// Recursive descent straight to postfix:
+//   expr := term (('+'|'-') term)*
+//   term := unary (('*'|'/') unary)*
+//   unary := '-' unary | number | name | '(' expr ')'
+// `depth_` tracks the evaluation stack so RunDerivedProgram never overflows.
+class Compiler {
+ public:
+  Compiler(const char* text, DerivedProgram& prog)
+      : p_(text), prog_(prog), depth_(0), last_op_(0), err_(nullptr) {}
+
+  bool run() {
+    skipSpace();
+    if (*p_ == '\0') return true;
+    if (!parseExpr()) return false;
+    skipSpace();
+    if (*p_ != '\0') return fail("unexpected character");
+    return true;
+  }
+  const char* error() const { return err_; }
+
+ private:
+  bool fail(const char* msg) {
+    if (!err_) err_ = msg;
+    return false;
+  }
+  void skipSpace() {
+    while (*p_ == ' ' || *p_ == '\t') ++p_;
+  }
+  bool emit(uint8_t byte) {
+    if (prog_.code_len >= DerivedProgram::kMaxCode) return fail("expression too long");
+    prog_.code[prog_.code_len++] = byte;
+    return true;
+  }
+  bool push(uint8_t op, uint8_t operand) {
+    if (depth_ >= DerivedProgram::kMaxStack) return fail("expression too deep");
+    ++depth_;
+    last_op_ = prog_.code_len;
+    return emit(op) && emit(operand);
+  }
+  // Operand-less op consuming `pops` stack entries beyond its result.
+  bool emitOp(uint8_t op, uint8_t pops) {
+    depth_ = static_cast<uint8_t>(depth_ - pops);
+    last_op_ = prog_.code_len;
+    return emit(op);
+  }
+
+  bool parseExpr() {
+    if (!parseTerm()) return false;
+    for (;;) {
+      skipSpace();
+      const char c = *p_;
+      if (c != '+' && c != '-') return true;
+      ++p_;
+      if (!parseTerm() || !emitOp(c == '+' ? kOpAdd : kOpSub, 1)) return false;
+    }
+  }
+
+  bool parseTerm() {
+    if (!parseUnary()) return false;
+    for (;;) {
+      skipSpace();
+      const char c = *p_;
+      if (c != '*' && c != '/') return true;
+      ++p_;
+      if (!parseUnary() || !emitOp(c == '*' ? kOpMul : kOpDiv, 1)) return false;
+    }
+  }
+
+  bool parseUnary() {
+    skipSpace();
+    const char c = *p_;
+    if (c == '-') {
+      ++p_;
+      if (!parseUnary()) return false;
+      // Fold "-<number>" into the constant.
+      if (prog_.code[last_op_] == kOpConst) {
+        float& k = prog_.consts[prog_.code[last_op_ + 1]];
+        k = -k;
+        return true;
+      }
+      return emitOp(kOpNeg, 0);
+    }
+    if (c == '(') {
+      ++p_;
+      if (!parseExpr()) return false;
+      skipSpace();
+      if (*p_ != ')') return fail("missing ')'");
+      ++p_;
+      return true;
+    }
+    if (isdigit(static_cast<unsigned char>(c)) || c == '.') {
+      char* end = nullptr;
+      const float v = strtof(p_, &end);
+      if (end == p_ || !isfinite(v)) return fail("bad number");
+      p_ = end;
+      if (prog_.const_count >= DerivedProgram::kMaxConsts) {
+        return fail("too many constants");
+      }
+      prog_.consts[prog_.const_count] = v;
+      return push(kOpConst, prog_.const_count++);
+    }
+    if (isalpha(static_cast<unsigned char>(c)) || c == '_') {
+      const char* start = p_;
+      while (isalnum(static_cast<unsigned char>(*p_)) || *p_ == '_') ++p_;
+      const SignalId id = LookupSignalName(start, static_cast<size_t>(p_ - start));
+      if (id == kInvalidSignalId) return fail("unknown signal");
+      prog_.inputs |= SignalBit(id);
+      return push(kOpSignal, static_cast<uint8_t>(id));
+    }
+    return fail(c == '\0' ? "unexpected end" : "unexpected character");
+  }
+
+  const char* p_;
+  DerivedProgram& prog_;
+  uint8_t depth_;
+  uint8_t last_op_;  // offset of the newest op, for constant folding
+  const char* err_;
+};
+
+}  // namespace
+
+// Walks the bytecode the way RunDerivedProgram does, without loading
+// anything: every operand present, const indices in range, the stack never
+// under- or overflows and exactly one value is left.
+bool VerifyDerivedProgram(const DerivedProgram& prog) {
+  if (prog.code_len > DerivedProgram::kMaxCode ||
+      prog.const_count > DerivedProgram::kMaxConsts) {
+    return false;
+  }
+  uint8_t depth = 0;
+  for (uint8_t pc = 0; pc < prog.code_len; ++pc) {
+    switch (prog.code[pc]) {
+      case kOpConst:
+      case kOpSignal:
+        if (pc + 1 >= prog.code_len || depth >= DerivedProgram::kMaxStack) return false;
+        ++pc;
+        if (prog.code[pc - 1] == kOpConst ? prog.code[pc] >= prog.const_count
+                                          : prog.code[pc] >= kSignalCount) {
+          return false;
+        }
+        ++depth;
+        break;
+      case kOpNeg:
+        if (depth < 1) return false;
+        break;
+      case kOpAdd:
+      case kOpSub:
+      case kOpMul:
+      case kOpDiv:
+        if (depth < 2) return false;
+        --depth;
+        break;
+      default:
+        return false;
+    }
+  }
+  return prog.code_len == 0 || depth == 1;
+}
+
+bool CompileDerivedExpr(const char* expr, DerivedProgram& out, const char** err) {
+  out = DerivedProgram{};
+  Compiler c(expr ? expr : "", out);
+  if (c.run()) {
+    if (VerifyDerivedProgram(out)) return true;
+    if (err) *err = "invalid program";
+  } else if (err) {
+    *err = c.error();
+  }
+  out = DerivedProgram{};
+  return false;
+}
+
+// Bounds are checked again here: the program is already verified, but it
+// must not touch memory outside its arrays even if it is corrupted later.
+bool RunDerivedProgram(const DerivedProgram& prog, DerivedLoadFn load,
+                       const void* ctx, float& out) {
+  if (prog.code_len == 0 || prog.code_len > DerivedProgram::kMaxCode) return false;
+  float stack[DerivedProgram::kMaxStack];
+  uint8_t sp = 0;
+  for (uint8_t pc = 0; pc < prog.code_len; ++pc) {
+    const uint8_t op = prog.code[pc];
+    if (op == kOpConst || op == kOpSignal) {
+      if (pc + 1 >= prog.code_len || sp >= DerivedProgram::kMaxStack) return false;
+      const uint8_t operand = prog.code[++pc];
+      if (op == kOpConst) {
+        if (operand >= prog.const_count || operand >= DerivedProgram::kMaxConsts) {
+          return false;
+        }
+        stack[sp++] = prog.consts[operand];
+      } else {
+        if (!load || !load(ctx, static_cast<SignalId>(operand), stack[sp])) return false;
+        ++sp;
+      }
+      continue;
+    }
+    if (sp < ((op == kOpNeg) ? 1 : 2)) return false;
+    switch (op) {
+      case kOpNeg:
+        stack[sp - 1] = -stack[sp - 1];
+        break;
+      case kOpAdd:
+        --sp;
+        stack[sp - 1] += stack[sp];
+        break;
+      case kOpSub:
+        --sp;
+        stack[sp - 1] -= stack[sp];
+        break;
+      case kOpMul:
+        --sp;
+        stack[sp - 1] *= stack[sp];
+        break;
+      case kOpDiv:
+        --sp;
+        if (stack[sp] == 0.0f) return false;
+        stack[sp - 1] /= stack[sp];
+        break;
+      default:
+        return false;
+    }
+  }
+  if (sp != 1) return false;
+  out = stack[0];
+  return isfinite(out);
+}
+
+DerivedChannels::DerivedChannels() : pending_(), pending_seq_(0), epoch_(0), active_() {}
+
+bool DerivedChannels::configure(const DerivedChannelCfg* cfg, uint8_t count,
+                                uint8_t* bad_channel, const char** err) {
+  DerivedProgram compiled[kDerivedChannelCount];
+  for (uint8_t k = 0; k < kDerivedChannelCount; ++k) {
+    const char* text = (cfg && k < count) ? cfg[k].expr : "";
+    const char* why = nullptr;
+    bool ok = CompileDerivedExpr(text, compiled[k], &why);
+    for (uint8_t j = k; ok && j < kDerivedChannelCount; ++j) {
+      if (compiled[k].inputs & SignalBit(DerivedSignal(j))) {
+        why = "may only use lower-numbered channels";
+        ok = false;
+      }
+    }
+    if (!ok) {
+      if (bad_channel) *bad_channel = k;
+      if (err) *err = why;
+      return false;
+    }
+  }
+  // One-writer seqlock over pending_, as in SignalFilters::configure.
+  const uint32_t s = __atomic_load_n(&pending_seq_, __ATOMIC_RELAXED);
+  __atomic_store_n(&pending_seq_, s + 1, __ATOMIC_RELAXED);
+  __atomic_thread_fence(__ATOMIC_RELEASE);
+  memcpy(pending_, compiled, sizeof(pending_));
+  __atomic_store_n(&pending_seq_, s + 2, __ATOMIC_RELEASE);
+  return true;
+}
+
+void DerivedChannels::sync() {
+  const uint32_t want = __atomic_load_n(&pending_seq_, __ATOMIC_ACQUIRE);
+  if (want == epoch_ || (want & 0x1U)) return;  // current, or mid-update
+  DerivedProgram copy[kDerivedChannelCount];
+  memcpy(copy, pending_, sizeof(copy));
+  __atomic_thread_fence(__ATOMIC_ACQUIRE);
+  // Torn copy: keep the current programs and retry at the next update.
+  if (__atomic_load_n(&pending_seq_, __ATOMIC_RELAXED) != want) return;
+  epoch_ = want;
+  memcpy(active_, copy, sizeof(active_));
+}
+
+bool DerivedChannels::evaluate(uint8_t channel, DerivedLoadFn load, const void* ctx,
+                               float& out) const {
+  if (channel >= kDerivedChannelCount) return false;
+  return RunDerivedProgram(active_[channel], load, ctx, out);
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "data/datastore.h"
+
+// Virtual signals (kDerived1..3) computed from other signals by small
+// arithmetic expressions, e.g. injector duty "PW1*RPM/1200" or AFR error
+// "AFR1-AFRtg1". Expressions are compiled once at config time to stack
+// bytecode; the store re-runs a channel inside its write sequence only when
+// one of the channel's inputs was written.
+//
+// Grammar: numbers, signal names from the contract (case-insensitive),
+// + - * /, unary minus and parentheses. A channel is valid only while every
+// input is valid; division by zero leaves it unwritten (it then goes stale).
+
+constexpr uint8_t kDerivedChannelCount = 3;
+constexpr size_t kDerivedExprLen = 40;
+
+struct DerivedChannelCfg {
+  char expr[kDerivedExprLen] = "";  // empty = channel off
+};
+
+constexpr SignalId DerivedSignal(uint8_t channel) {
+  return static_cast<SignalId>(static_cast<uint8_t>(SignalId::kDerived1) + channel);
+}
+
+struct DerivedProgram {
+  static constexpr uint8_t kMaxCode = 32;
+  static constexpr uint8_t kMaxConsts = 8;
+  static constexpr uint8_t kMaxStack = 8;
+
+  uint8_t code[kMaxCode];
+  float consts[kMaxConsts];
+  uint8_t code_len = 0;
+  uint8_t const_count = 0;
+  SignalMask inputs = 0;
+};
+
+// Empty/blank text compiles to an empty program. On failure `err` (when
+// given) points to a static description of the first problem.
+bool CompileDerivedExpr(const char* expr, DerivedProgram& out,
+                        const char** err = nullptr);
+
+// Structural check of compiled bytecode (operands, const indices, stack
+// depth); CompileDerivedExpr only returns programs that pass it.
+bool VerifyDerivedProgram(const DerivedProgram& prog);
+
+// Loads one input; false when it is not currently valid.
+using DerivedLoadFn = bool (*)(const void* ctx, SignalId id, float& out);
+// False for an empty program, an unavailable input, a non-finite result or
+// malformed bytecode (checked as it runs).
+bool RunDerivedProgram(const DerivedProgram& prog, DerivedLoadFn load,
+                       const void* ctx, float& out);
+
+class DerivedChannels {
+ public:
+  DerivedChannels();
+
+  // Compiles the table (index = channel); safe from one configuring task, the
+  // writer adopts it at its next update that sees a complete table. On a compile error nothing changes
+  // and `bad_channel`/`err` describe the first failure. A channel may read
+  // lower-numbered channels but not itself or later ones.
+  bool configure(const DerivedChannelCfg* cfg, uint8_t count,
+                 uint8_t* bad_channel = nullptr, const char** err = nullptr);
+
+  // Writer side (DataStore only).
+  void sync();
+  SignalMask inputs(uint8_t channel) const {
+    return (channel < kDerivedChannelCount) ? active_[channel].inputs : 0;
+  }
+  bool evaluate(uint8_t channel, DerivedLoadFn load, const void* ctx,
+                float& out) const;
+
+ private:
+  DerivedProgram pending_[kDerivedChannelCount];
+  uint32_t pending_seq_;  // seqlock over pending_; atomic access only
+  uint32_t epoch_;        // pending_seq_ of the adopted programs
+  DerivedProgram active_[kDerivedChannelCount];
+};
@@ -0,0 +1,216 @@
+#include "data/signal_aggregates.h"
+
+#include <string.h>
+
+namespace {
+
+constexpr size_t kBuiltInCount = static_cast<size_t>(SignalId::kCount);
+constexpr uint8_t kDequeCap = SignalAggregates::kBuckets + 1;
+
+}  // namespace
+
+SignalAggregates::SignalAggregates()
+    : window_count_(0), min_epoch_req_(0), max_epoch_req_(0) {
+  memset(extrema_, 0, sizeof(extrema_));
+  memset(window_lookup_, 0, sizeof(window_lookup_));
+  clear();
+}
+
+bool SignalAggregates::trackWindow(SignalId id, uint32_t window_ms,
+                                   float ewma_alpha) {
+  const size_t idx = static_cast<size_t>(id);
+  if (idx >= kBuiltInCount || window_lookup_[idx] != 0 ||
+      window_count_ >= kMaxWindows || window_ms < kBuckets ||
+      !(ewma_alpha > 0.0f && ewma_alpha <= 1.0f)) {
+    return false;
+  }
+  Window& w = windows_[window_count_];
+  w.id = id;
+  w.window_ms = window_ms;
+  w.bucket_ms = window_ms / kBuckets;
+  w.alpha = ewma_alpha;
+  ResetWindow(w);
+  ++window_count_;
+  window_lookup_[idx] = window_count_;
+  return true;
+}
+
+void SignalAggregates::ResetWindow(Window& w) {
+  w.bucket_start_ms = 0;
+  w.bucket_min = 0.0f;
+  w.bucket_max = 0.0f;
+  w.bucket_open = false;
+  w.max_q.head = w.max_q.count = 0;
+  w.min_q.head = w.min_q.count = 0;
+  w.ewma = 0.0f;
+  w.mean = 0.0f;
+  w.count = 0;
+}
+
+void SignalAggregates::clear() {
+  for (size_t i = 0; i < kBuiltInCount; ++i) {
+    Extrema& e = extrema_[i];
+    e.min = 0.0f;
+    e.max = 0.0f;
+    e.gen = static_cast<uint16_t>(e.gen + 1);
+    e.min_epoch = 0;
+    e.max_epoch = 0;
+    e.has_min = false;
+    e.has_max = false;
+  }
+  for (uint8_t i = 0; i < window_count_; ++i) {
+    ResetWindow(windows_[i]);
+  }
+}
+
+void SignalAggregates::requestReset(bool reset_min, bool reset_max) {
+  if (reset_min) __atomic_fetch_add(&min_epoch_req_, 1, __ATOMIC_RELAXED);
+  if (reset_max) __atomic_fetch_add(&max_epoch_req_, 1, __ATOMIC_RELAXED);
+}
+
+void SignalAggregates::Expire(Deque& q, uint32_t now_ms, uint32_t window_ms) {
+  while (q.count > 0 && (now_ms - q.items[q.head].start_ms) > window_ms) {
+    q.head = static_cast<uint8_t>((q.head + 1) % kDequeCap);
+    --q.count;
+  }
+}
+
+void SignalAggregates::PushMax(Deque& q, const Bucket& b) {
+  while (q.count > 0) {
+    const uint8_t back = static_cast<uint8_t>((q.head + q.count - 1) % kDequeCap);
+    if (q.items[back].value > b.value) break;
+    --q.count;
+  }
+  if (q.count == kDequeCap) {
+    q.head = static_cast<uint8_t>((q.head + 1) % kDequeCap);
+    --q.count;
+  }
+  q.items[(q.head + q.count) % kDequeCap] = b;
+  ++q.count;
+}
+
+void SignalAggregates::PushMin(Deque& q, const Bucket& b) {
+  while (q.count > 0) {
+    const uint8_t back = static_cast<uint8_t>((q.head + q.count - 1) % kDequeCap);
+    if (q.items[back].value < b.value) break;
+    --q.count;
+  }
+  if (q.count == kDequeCap) {
+    q.head = static_cast<uint8_t>((q.head + 1) % kDequeCap);
+    --q.count;
+  }
+  q.items[(q.head + q.count) % kDequeCap] = b;
+  ++q.count;
+}
+
+void SignalAggregates::CloseBucket(Window& w, uint32_t now_ms) {
+  Expire(w.max_q, now_ms, w.window_ms);
+  Expire(w.min_q, now_ms, w.window_ms);
+  PushMax(w.max_q, Bucket{w.bucket_start_ms, w.bucket_max});
+  PushMin(w.min_q, Bucket{w.bucket_start_ms, w.bucket_min});
+  w.bucket_open = false;
+}
+
+void SignalAggregates::record(SignalId id, float phys, uint32_t ts_ms) {
+  const size_t idx = static_cast<size_t>(id);
+  if (idx >= kBuiltInCount || phys != phys) {
+    return;
+  }
+  Extrema& e = extrema_[idx];
+  const uint8_t min_req = __atomic_load_n(&min_epoch_req_, __ATOMIC_RELAXED);
+  const uint8_t max_req = __atomic_load_n(&max_epoch_req_, __ATOMIC_RELAXED);
+  bool moved = false;
+  if (!e.has_min || e.min_epoch != min_req || phys < e.min) {
+    e.min = phys;
+    e.min_epoch = min_req;
+    e.has_min = true;
+    moved = true;
+  }
+  if (!e.has_max || e.max_epoch != max_req || phys > e.max) {
+    e.max = phys;
+    e.max_epoch = max_req;
+    e.has_max = true;
+    moved = true;
+  }
+  if (moved) {
+    e.gen = static_cast<uint16_t>(e.gen + 1);
+  }
+
+  if (window_lookup_[idx] == 0) {
+    return;
+  }
+  Window& w = windows_[window_lookup_[idx] - 1];
+  if (w.bucket_open && (ts_ms - w.bucket_start_ms) >= w.bucket_ms) {
+    CloseBucket(w, ts_ms);
+  }
+  if (!w.bucket_open) {
+    w.bucket_open = true;
+    w.bucket_start_ms = ts_ms;
+    w.bucket_min = phys;
+    w.bucket_max = phys;
+  } else {
+    if (phys < w.bucket_min) w.bucket_min = phys;
+    if (phys > w.bucket_max) w.bucket_max = phys;
+  }
+  ++w.count;
+  if (w.count == 1) {
+    w.ewma = phys;
+    w.mean = phys;
+  } else {
+    w.ewma += w.alpha * (phys - w.ewma);
+    w.mean += (phys - w.mean) / static_cast<float>(w.count);
+  }
+}
+
+void SignalAggregates::readExtrema(SignalExtrema* out, size_t count) const {
+  if (!out) return;
+  const uint8_t min_req = __atomic_load_n(&min_epoch_req_, __ATOMIC_RELAXED);
+  const uint8_t max_req = __atomic_load_n(&max_epoch_req_, __ATOMIC_RELAXED);
+  for (size_t i = 0; i < count; ++i) {
+    SignalExtrema& o = out[i];
+    if (i >= kBuiltInCount) {
+      o = SignalExtrema{0.0f, 0.0f, 0, false, false};
+      continue;
+    }
+    const Extrema& e = extrema_[i];
+    o.min = e.min;
+    o.max = e.max;
+    o.gen = e.gen;
+    o.has_min = e.has_min && e.min_epoch == min_req;
+    o.has_max = e.has_max && e.max_epoch == max_req;
+  }
+}
+
+bool SignalAggregates::FrontLive(const Deque& q, uint32_t now_ms,
+                                 uint32_t window_ms, float& out) {
+  for (uint8_t k = 0; k < q.count; ++k) {
+    const Bucket& b = q.items[(q.head + k) % kDequeCap];
+    if ((now_ms - b.start_ms) <= window_ms) {
+      out = b.value;
+      return true;
+    }
+  }
+  return false;
+}
+
+bool SignalAggregates::readWindow(SignalId id, uint32_t now_ms,
+                                  WindowStats& out) const {
+  out = WindowStats{0.0f, 0.0f, 0.0f, 0.0f, 0, false};
+  const size_t idx = static_cast<size_t>(id);
+  if (idx >= kBuiltInCount || window_lookup_[idx] == 0) {
+    return false;
+  }
+  const Window& w = windows_[window_lookup_[idx] - 1];
+  out.ewma = w.ewma;
+  out.mean = w.mean;
+  out.count = w.count;
+  bool have_max = FrontLive(w.max_q, now_ms, w.window_ms, out.max);
+  bool have_min = FrontLive(w.min_q, now_ms, w.window_ms, out.min);
+  if (w.bucket_open && (now_ms - w.bucket_start_ms) <= w.window_ms) {
+    if (!have_max || w.bucket_max > out.max) out.max = w.bucket_max;
+    if (!have_min || w.bucket_min < out.min) out.min = w.bucket_min;
+    have_max = have_min = true;
+  }
+  out.valid = have_max && have_min;
+  return true;
+}
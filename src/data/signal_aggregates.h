@@ -0,0 +1,102 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "data/datastore.h"
+
+// Streaming aggregates, updated only when a value is written to the store.
+// - Extrema since the last reset for every built-in signal.
+// - Sliding-window min/max, EWMA and running mean for a few tracked channels
+//   (e.g. 10 s peak boost). Windows use kBuckets time buckets feeding a
+//   monotonic deque, so memory is fixed and queries touch at most a few
+//   entries.
+
+struct SignalExtrema {
+  float min;
+  float max;
+  uint16_t gen;  // bumps whenever min or max moves (or after a reset)
+  bool has_min;
+  bool has_max;
+};
+
+struct WindowStats {
+  float min;
+  float max;
+  float ewma;
+  float mean;
+  uint32_t count;  // samples since reset
+  bool valid;      // at least one sample inside the window
+};
+
+class SignalAggregates {
+ public:
+  static constexpr uint8_t kMaxWindows = 4;
+  static constexpr uint8_t kBuckets = 16;
+
+  SignalAggregates();
+
+  // Boot-time: sliding window over `window_ms` plus EWMA with `ewma_alpha`.
+  bool trackWindow(SignalId id, uint32_t window_ms, float ewma_alpha);
+  // Writer side: drops all aggregate state (window layout is kept).
+  void clear();
+  void record(SignalId id, float phys, uint32_t ts_ms);
+
+  // Reader side: asks the writer to restart extrema at the next sample. Safe
+  // from any task; until then the affected side reads as empty.
+  void requestReset(bool reset_min, bool reset_max);
+
+  void readExtrema(SignalExtrema* out, size_t count) const;
+  bool readWindow(SignalId id, uint32_t now_ms, WindowStats& out) const;
+
+ private:
+  struct Extrema {
+    float min;
+    float max;
+    uint16_t gen;
+    uint8_t min_epoch;
+    uint8_t max_epoch;
+    bool has_min;
+    bool has_max;
+  };
+  struct Bucket {
+    uint32_t start_ms;
+    float value;
+  };
+  // Ring of bucket extrema; values are monotonic from front to back.
+  struct Deque {
+    Bucket items[kBuckets + 1];
+    uint8_t head;
+    uint8_t count;
+  };
+  struct Window {
+    SignalId id;
+    uint32_t window_ms;
+    uint32_t bucket_ms;
+    uint32_t bucket_start_ms;
+    float bucket_min;
+    float bucket_max;
+    bool bucket_open;
+    Deque max_q;
+    Deque min_q;
+    float alpha;
+    float ewma;
+    float mean;
+    uint32_t count;
+  };
+
+  static void CloseBucket(Window& w, uint32_t now_ms);
+  static void Expire(Deque& q, uint32_t now_ms, uint32_t window_ms);
+  static void PushMax(Deque& q, const Bucket& b);
+  static void PushMin(Deque& q, const Bucket& b);
+  static bool FrontLive(const Deque& q, uint32_t now_ms, uint32_t window_ms,
+                        float& out);
+  static void ResetWindow(Window& w);
+
+  Extrema extrema_[static_cast<size_t>(SignalId::kCount)];
+  Window windows_[kMaxWindows];
+  uint8_t window_count_;
+  uint8_t window_lookup_[static_cast<size_t>(SignalId::kCount)];  // index + 1
+  uint8_t min_epoch_req_;  // atomic access only
+  uint8_t max_epoch_req_;
+};
@@ -5,35 +5,71 @@
 #include "config/logging.h"
 #endif
 
+namespace {
+
+// Dense: entry i describes SignalId(i). Limits are the plausibility gate used
+// by CAN ingest, so keep them wide enough for real transients (cranking
+// voltage dips, cold EGT, closed-loop EGO pulling fuel). Deadbands are set
+// only on slow temperatures and swallow one decode LSB (0.1 F / 1 F) of
+// jitter.
+constexpr SignalContractEntry kTable[] = {
+    {SignalId::kMap, "MAP", "kPa", 0.0f, 400.0f, 0.0f},
+    {SignalId::kClt, "CLT", "F", -40.0f, 300.0f, 0.15f},
+    {SignalId::kRpm, "RPM", "rpm", 0.0f, 12000.0f, 0.0f},
+    {SignalId::kTps, "TPS", "%", 0.0f, 100.0f, 0.0f},
+    {SignalId::kMat, "MAT", "F", -40.0f, 300.0f, 0.15f},
+    {SignalId::kAdv, "ADV", "deg", -40.0f, 80.0f, 0.0f},
+    {SignalId::kPw1, "PW1", "ms", 0.0f, 50.0f, 0.0f},
+    {SignalId::kPw2, "PW2", "ms", 0.0f, 50.0f, 0.0f},
+    {SignalId::kPwSeq1, "PWSeq1", "ms", 0.0f, 50.0f, 0.0f},
+    {SignalId::kEgoCor1, "EGOcor1", "%", -50.0f, 200.0f, 0.0f},
+    {SignalId::kAfr1, "AFR1", "AFR", 5.0f, 25.0f, 0.0f},
+    {SignalId::kAfrTarget1, "AFRtg1", "AFR", 5.0f, 25.0f, 0.0f},
+    {SignalId::kEgt1, "EGT1", "F", 0.0f, 2000.0f, 1.5f},
+    {SignalId::kBatt, "BATT", "V", 6.0f, 18.5f, 0.0f},
+    {SignalId::kKnkRetard, "Knk", "deg", 0.0f, 20.0f, 0.0f},
+    {SignalId::kSensors1, "SENS1", "raw", -1e6f, 1e6f, 0.0f},
+    {SignalId::kSensors2, "SENS2", "raw", -1e6f, 1e6f, 0.0f},
+    {SignalId::kLaunchTiming, "Launch", "deg", -40.0f, 80.0f, 0.0f},
+    {SignalId::kTcRetard, "TC Retard", "deg", -40.0f, 80.0f, 0.0f},
+    {SignalId::kVss1, "VSS1", "m/s", 0.0f, 120.0f, 0.0f},
+    {SignalId::kDerived1, "DRV1", "", -1e6f, 1e6f, 0.0f},
+    {SignalId::kDerived2, "DRV2", "", -1e6f, 1e6f, 0.0f},
+    {SignalId::kDerived3, "DRV3", "", -1e6f, 1e6f, 0.0f},
+};
+
+constexpr bool TableIsDense(size_t i) {
+  return i >= kSignalCount ||
+         (kTable[i].id == static_cast<SignalId>(i) && TableIsDense(i + 1));
+}
+
+static_assert(sizeof(kTable) / sizeof(kTable[0]) == kSignalCount,
+              "signal contract must cover every SignalId");
+static_assert(TableIsDense(0), "signal contract must be ordered by SignalId");
+
+constexpr SignalLimits LimitsAt(size_t i) { return {kTable[i].min, kTable[i].max}; }
+
+// Compile-time projection of kTable; no lazy init shared between tasks.
+constexpr SignalLimits kLimits[] = {
+    LimitsAt(0),  LimitsAt(1),  LimitsAt(2),  LimitsAt(3),  LimitsAt(4),
+    LimitsAt(5),  LimitsAt(6),  LimitsAt(7),  LimitsAt(8),  LimitsAt(9),
+    LimitsAt(10), LimitsAt(11), LimitsAt(12), LimitsAt(13), LimitsAt(14),
+    LimitsAt(15), LimitsAt(16), LimitsAt(17), LimitsAt(18), LimitsAt(19),
+    LimitsAt(20), LimitsAt(21), LimitsAt(22),
+};
+static_assert(sizeof(kLimits) / sizeof(kLimits[0]) == kSignalCount,
+              "limits projection must cover every SignalId");
+
+}  // namespace
+
 const SignalContractEntry* LookupSignalContract(SignalId id) {
-  static const SignalContractEntry kTable[] = {
-      {SignalId::kMap, "MAP", "kPa", 10.0f, 400.0f},
-      {SignalId::kClt, "CLT", "F", -40.0f, 300.0f},
-      {SignalId::kMat, "MAT", "F", -40.0f, 260.0f},
-      {SignalId::kRpm, "RPM", "rpm", 0.0f, 12000.0f},
-      {SignalId::kTps, "TPS", "%", 0.0f, 100.0f},
-      {SignalId::kAdv, "ADV", "deg", -40.0f, 80.0f},
-      {SignalId::kLaunchTiming, "Launch", "deg", -40.0f, 80.0f},
-      {SignalId::kTcRetard, "TC Retard", "deg", 0.0f, 30.0f},
-      {SignalId::kPw1, "PW1", "ms", 0.0f, 50.0f},
-      {SignalId::kPw2, "PW2", "ms", 0.0f, 50.0f},
-      {SignalId::kPwSeq1, "PWSeq1", "ms", 0.0f, 50.0f},
-      {SignalId::kEgoCor1, "EGOcor1", "%", 0.0f, 200.0f},
-      {SignalId::kAfr1, "AFR1", "AFR", 5.0f, 25.0f},
-      {SignalId::kAfrTarget1, "AFRtg1", "AFR", 5.0f, 25.0f},
-      {SignalId::kEgt1, "EGT1", "F", 200.0f, 2000.0f},
-      {SignalId::kBatt, "BATT", "V", 8.0f, 18.0f},
-      {SignalId::kKnkRetard, "Knk", "deg", 0.0f, 20.0f},
-      {SignalId::kVss1, "VSS1", "m/s", 0.0f, 120.0f},
-      {SignalId::kSensors1, "SENS1", "raw", -1e6f, 1e6f},
-      {SignalId::kSensors2, "SENS2", "raw", -1e6f, 1e6f},
-  };
-  for (const auto& e : kTable) {
-    if (e.id == id) return &e;
-  }
-  return nullptr;
+  const size_t idx = static_cast<size_t>(id);
+  if (idx >= kSignalCount) return nullptr;
+  return &kTable[idx];
 }
 
+const SignalLimits* DefaultSignalLimits() { return kLimits; }
+
 void ValidateSignalContract(SignalId id, float value) {
 #ifdef DEBUG_VALIDATE_SIGNAL_CONTRACT
   const SignalContractEntry* ent = LookupSignalContract(id);
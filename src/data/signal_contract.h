@@ -20,13 +20,49 @@
 // - kBatt: volts
 // - kVss1: m/s
 // - kSensors1 / kSensors2: raw ADC or generic units (no enforced range)
+// - kDerived1..3: units of the user's expression (no enforced range)
 struct SignalContractEntry {
   SignalId id;
   const char* name;
   const char* unit;
   float min;
   float max;
+  // Ingest deadband in raw units: a sample within this of the stored value
+  // only refreshes freshness (no change notification). 0 = exact repeats,
+  // negative = off.
+  float deadband;
 };
 
+// Plausibility bounds used to gate decoded values before they reach the
+// DataStore. Tables are dense and indexed by SignalId: the contract defaults
+// below cover the kCount built-ins; SignalRegistry::limits() extends them with
+// profile overrides and declared channels and is what ingest checks.
+struct SignalLimits {
+  float min;
+  float max;
+};
+
+constexpr size_t kSignalCount = static_cast<size_t>(SignalId::kCount);
+
 const SignalContractEntry* LookupSignalContract(SignalId id);
 void ValidateSignalContract(SignalId id, float value);
+
+// Dense limits generated from the contract table above.
+const SignalLimits* DefaultSignalLimits();
+
+// Checks a decoded batch (any type with .id / .phys) in one pass. Bit i of the
+// result is set when batch[i] is outside limits; NaN fails both compares and
+// is rejected. Ids beyond limit_count are never rejected here. count <= 32.
+template <typename T>
+uint32_t SignalRejectMask(const SignalLimits* limits, size_t limit_count,
+                          const T* batch, uint8_t count) {
+  uint32_t mask = 0;
+  for (uint8_t i = 0; i < count; ++i) {
+    const size_t idx = static_cast<size_t>(batch[i].id);
+    if (idx >= limit_count) continue;
+    const float v = batch[i].phys;
+    const bool ok = (v >= limits[idx].min) & (v <= limits[idx].max);
+    mask |= static_cast<uint32_t>(!ok) << i;
+  }
+  return mask;
+}
@@ -0,0 +1,187 @@
+#include "data/signal_filter.h"
+
+#include <string.h>
+
+namespace {
+
+constexpr float kScale = static_cast<float>(1 << SignalFilters::kFracBits);
+
+int32_t ToFixed(float v) {
+  const float q = v * kScale;
+  if (q >= 2147483520.0f) return INT32_MAX;
+  if (q <= -2147483520.0f) return INT32_MIN;
+  return static_cast<int32_t>(q >= 0.0f ? q + 0.5f : q - 0.5f);
+}
+
+float FromFixed(int32_t q) { return static_cast<float>(q) / kScale; }
+
+int32_t MedianOf(const int32_t* values, uint8_t n) {
+  int32_t sorted[5];
+  for (uint8_t i = 0; i < n; ++i) {
+    int32_t v = values[i];
+    uint8_t k = i;
+    while (k > 0 && sorted[k - 1] > v) {
+      sorted[k] = sorted[k - 1];
+      --k;
+    }
+    sorted[k] = v;
+  }
+  return sorted[n / 2];
+}
+
+}  // namespace
+
+const char* FilterKindName(FilterKind kind) {
+  switch (kind) {
+    case FilterKind::kEma:
+      return "EMA";
+    case FilterKind::kMedian3:
+      return "Median 3";
+    case FilterKind::kMedian5:
+      return "Median 5";
+    case FilterKind::kRateLimit:
+      return "Rate limit";
+    case FilterKind::kNone:
+    default:
+      return "Off";
+  }
+}
+
+SignalFilterCfg SanitizeFilterCfg(SignalFilterCfg cfg) {
+  if (static_cast<uint8_t>(cfg.kind) >= static_cast<uint8_t>(FilterKind::kCount)) {
+    cfg.kind = FilterKind::kNone;
+  }
+  if ((cfg.kind == FilterKind::kEma || cfg.kind == FilterKind::kRateLimit) &&
+      cfg.param == 0) {
+    cfg.param = 1;
+  }
+  if (cfg.kind == FilterKind::kNone || cfg.kind == FilterKind::kMedian3 ||
+      cfg.kind == FilterKind::kMedian5) {
+    cfg.param = 0;
+  }
+  return cfg;
+}
+
+SignalFilters::SignalFilters()
+    : pending_(), pending_seq_(0), epoch_(0), channel_count_(0) {
+  memset(lookup_, 0, sizeof(lookup_));
+}
+
+// pending_ is a one-writer seqlock (same ordering as DataStore's sequence):
+// configure() publishes odd, the table, then even; the writer only adopts a
+// copy taken between two equal even reads, so it never runs a torn table.
+void SignalFilters::configure(const SignalFilterCfg* cfg, size_t count) {
+  const uint32_t s = __atomic_load_n(&pending_seq_, __ATOMIC_RELAXED);
+  __atomic_store_n(&pending_seq_, s + 1, __ATOMIC_RELAXED);
+  __atomic_thread_fence(__ATOMIC_RELEASE);
+  for (size_t i = 0; i < kSignals; ++i) {
+    pending_[i] = (cfg && i < count) ? SanitizeFilterCfg(cfg[i]) : SignalFilterCfg{};
+  }
+  __atomic_store_n(&pending_seq_, s + 2, __ATOMIC_RELEASE);
+}
+
+bool SignalFilters::adoptPending(uint32_t seq) {
+  SignalFilterCfg table[kSignals];
+  memcpy(table, pending_, sizeof(table));
+  __atomic_thread_fence(__ATOMIC_ACQUIRE);
+  if (__atomic_load_n(&pending_seq_, __ATOMIC_RELAXED) != seq) return false;
+  memset(lookup_, 0, sizeof(lookup_));
+  channel_count_ = 0;
+  for (size_t i = 0; i < kSignals && channel_count_ < kMaxChannels; ++i) {
+    if (table[i].kind == FilterKind::kNone) continue;
+    Channel& ch = channels_[channel_count_];
+    ch.cfg = table[i];
+    ++channel_count_;
+    lookup_[i] = channel_count_;
+  }
+  clear();
+  return true;
+}
+
+void SignalFilters::clear() {
+  for (uint8_t i = 0; i < channel_count_; ++i) {
+    channels_[i].head = 0;
+    channels_[i].count = 0;
+    channels_[i].last_ms = 0;
+    channels_[i].y = 0;
+    channels_[i].last_x = 0;
+    channels_[i].settled = false;
+  }
+}
+
+int32_t SignalFilters::Step(Channel& ch, int32_t x, uint32_t ts_ms) {
+  const bool first = ch.count == 0;
+  const uint32_t dt = first ? 0 : (ts_ms - ch.last_ms);
+  ch.last_ms = ts_ms;
+  switch (ch.cfg.kind) {
+    case FilterKind::kEma: {
+      if (first) {
+        ch.y = x;
+        ch.count = 1;
+        break;
+      }
+      // alpha = dt / (tau + dt) in Q16: sample-rate independent smoothing.
+      const uint32_t dt_c = (dt > 0xFFFFu) ? 0xFFFFu : dt;
+      const int64_t alpha = (static_cast<int64_t>(dt_c) << 16) /
+                            (static_cast<int64_t>(ch.cfg.param) + dt_c);
+      const int64_t err = static_cast<int64_t>(x) - ch.y;
+      ch.y = static_cast<int32_t>(ch.y + ((err * alpha + (1 << 15)) >> 16));
+      break;
+    }
+    case FilterKind::kMedian3:
+    case FilterKind::kMedian5: {
+      const uint8_t n = (ch.cfg.kind == FilterKind::kMedian3) ? 3 : 5;
+      ch.window[ch.head] = x;
+      ch.head = static_cast<uint8_t>((ch.head + 1) % n);
+      if (ch.count < n) ++ch.count;
+      ch.y = MedianOf(ch.window, ch.count);
+      break;
+    }
+    case FilterKind::kRateLimit: {
+      if (first) {
+        ch.y = x;
+        ch.count = 1;
+        break;
+      }
+      const int64_t max_step =
+          (static_cast<int64_t>(ch.cfg.param) * dt << SignalFilters::kFracBits) / 1000;
+      int64_t step = static_cast<int64_t>(x) - ch.y;
+      if (step > max_step) step = max_step;
+      if (step < -max_step) step = -max_step;
+      ch.y = static_cast<int32_t>(ch.y + step);
+      break;
+    }
+    case FilterKind::kNone:
+    default:
+      ch.y = x;
+      break;
+  }
+  return ch.y;
+}
+
+float SignalFilters::apply(SignalId id, float raw, uint32_t ts_ms) {
+  // Mid-update or torn copy: keep the current table and retry next sample.
+  const uint32_t want = __atomic_load_n(&pending_seq_, __ATOMIC_ACQUIRE);
+  if (want != epoch_ && !(want & 0x1U) && adoptPending(want)) {
+    epoch_ = want;
+  }
+  const size_t idx = static_cast<size_t>(id);
+  if (idx >= kSignals || lookup_[idx] == 0 || raw != raw) {
+    return raw;
+  }
+  Channel& ch = channels_[lookup_[idx] - 1];
+  const int32_t x = ToFixed(raw);
+  const bool repeat = ch.count != 0 && x == ch.last_x;
+  const int32_t before = ch.y;
+  const int32_t y = Step(ch, x, ts_ms);
+  ch.settled = repeat && y == before;
+  ch.last_x = x;
+  return FromFixed(y);
+}
+
+bool SignalFilters::settled(SignalId id) const {
+  if (__atomic_load_n(&pending_seq_, __ATOMIC_ACQUIRE) != epoch_) return false;
+  const size_t idx = static_cast<size_t>(id);
+  if (idx >= kSignals || lookup_[idx] == 0) return true;
+  return channels_[lookup_[idx] - 1].settled;
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "data/datastore.h"
+
+// Ingest-time smoothing for noisy channels (AFR, MAP, user sensors). Filters
+// run once per accepted sample inside the store's write sequence, in fixed
+// point (value * 256 in an int32); the store keeps the raw value alongside,
+// and alerts and derived channels read that instead of the smoothed one.
+
+enum class FilterKind : uint8_t {
+  kNone = 0,
+  kEma = 1,        // param: time constant in ms
+  kMedian3 = 2,
+  kMedian5 = 3,
+  kRateLimit = 4,  // param: max change per second, in signal units
+  kCount
+};
+
+struct SignalFilterCfg {
+  FilterKind kind = FilterKind::kNone;
+  uint16_t param = 0;
+};
+
+const char* FilterKindName(FilterKind kind);
+// Unknown kinds become kNone; EMA/rate-limit params are kept >= 1.
+SignalFilterCfg SanitizeFilterCfg(SignalFilterCfg cfg);
+
+class SignalFilters {
+ public:
+  static constexpr uint8_t kMaxChannels = 6;
+  static constexpr int kFracBits = 8;
+
+  SignalFilters();
+
+  // Full per-signal table (index = SignalId). Safe from one configuring task;
+  // the writer adopts it at its next sample that sees a complete table and
+  // restarts filter state.
+  void configure(const SignalFilterCfg* cfg, size_t count);
+
+  // Writer side (DataStore only).
+  void clear();
+  float apply(SignalId id, float raw, uint32_t ts_ms);
+  // True when feeding the same input again would not move the output: the
+  // signal is unfiltered, or its last sample repeated the previous input and
+  // left the output unchanged (a pending reconfigure is never settled).
+  bool settled(SignalId id) const;
+
+ private:
+  static constexpr size_t kSignals = static_cast<size_t>(SignalId::kCount);
+  static constexpr uint8_t kWindow = 5;
+
+  struct Channel {
+    SignalFilterCfg cfg;
+    int32_t y;
+    int32_t window[kWindow];
+    uint8_t head;
+    uint8_t count;
+    uint32_t last_ms;
+    int32_t last_x;
+    bool settled;
+  };
+
+  bool adoptPending(uint32_t seq);
+  static int32_t Step(Channel& ch, int32_t x, uint32_t ts_ms);
+
+  SignalFilterCfg pending_[kSignals];
+  uint32_t pending_seq_;  // seqlock over pending_; atomic access only
+  uint32_t epoch_;        // pending_seq_ of the adopted table
+  Channel channels_[kMaxChannels];
+  uint8_t channel_count_;
+  uint8_t lookup_[kSignals];  // channel + 1, 0 = unfiltered
+};
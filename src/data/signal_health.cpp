@@ -0,0 +1,76 @@
+#include "data/signal_health.h"
+
+#include <string.h>
+
+namespace {
+
+constexpr size_t kBuiltInCount = static_cast<size_t>(SignalId::kCount);
+
+}  // namespace
+
+SignalHealth::SignalHealth() { clear(); }
+
+void SignalHealth::clear() { memset(entries_, 0, sizeof(entries_)); }
+
+void SignalHealth::recordAccepted(SignalId id, float phys, uint32_t prev_ts_ms,
+                                  uint16_t stale_ms, uint32_t now_ms) {
+  const size_t idx = static_cast<size_t>(id);
+  if (idx >= kBuiltInCount) return;
+  Entry& e = entries_[idx];
+  SignalHealthStats& s = e.stats;
+  if (prev_ts_ms != 0 && (now_ms - prev_ts_ms) > stale_ms &&
+      s.stale_events != 0xFFFFu) {
+    ++s.stale_events;
+  }
+  ++s.updates;
+  s.last_raw = phys;
+  s.last_ms = now_ms;
+  if (e.rate_start_ms == 0) {
+    e.rate_start_ms = now_ms;
+    e.rate_base = s.updates;
+  } else if ((now_ms - e.rate_start_ms) >= kRateWindowMs) {
+    s.rate_hz = static_cast<float>(s.updates - e.rate_base) * 1000.0f /
+                static_cast<float>(now_ms - e.rate_start_ms);
+    e.rate_start_ms = now_ms;
+    e.rate_base = s.updates;
+  }
+}
+
+void SignalHealth::recordRejected(SignalId id, float phys, uint32_t now_ms) {
+  const size_t idx = static_cast<size_t>(id);
+  if (idx >= kBuiltInCount) return;
+  SignalHealthStats& s = entries_[idx].stats;
+  ++s.rejects;
+  s.last_raw = phys;
+  s.last_ms = now_ms;
+}
+
+void SignalHealth::recordSuppressed(SignalId id) {
+  const size_t idx = static_cast<size_t>(id);
+  if (idx >= kBuiltInCount) return;
+  ++entries_[idx].stats.suppressed;
+}
+
+void SignalHealth::addInvalidMs(SignalId id, int32_t delta_ms) {
+  const size_t idx = static_cast<size_t>(id);
+  if (idx >= kBuiltInCount) return;
+  SignalHealthStats& s = entries_[idx].stats;
+  s.invalid_ms = static_cast<uint32_t>(static_cast<int32_t>(s.invalid_ms) + delta_ms);
+}
+
+void SignalHealth::read(SignalHealthStats* out, size_t count,
+                        uint32_t now_ms) const {
+  if (!out) return;
+  for (size_t i = 0; i < count; ++i) {
+    if (i >= kBuiltInCount) {
+      memset(&out[i], 0, sizeof(out[i]));
+      continue;
+    }
+    const Entry& e = entries_[i];
+    out[i] = e.stats;
+    // The rate only refreshes on samples; a silent channel reads as 0 Hz.
+    if (e.stats.updates == 0 || (now_ms - e.rate_start_ms) > 2 * kRateWindowMs) {
+      out[i].rate_hz = 0.0f;
+    }
+  }
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "data/datastore.h"
+
+// Per-signal ingest telemetry: which channel is rejecting, holding invalid or
+// dropping out. Fed by DataStore inside the write sequence (a few adds per
+// sample), read as one consistent table via DataStore::readHealth().
+
+struct SignalHealthStats {
+  uint32_t updates;        // accepted samples
+  uint32_t suppressed;     // accepted within the deadband (freshness only)
+  uint32_t rejects;        // samples held invalid instead of stored
+  uint32_t invalid_ms;     // invalid-hold time granted (clipped on recovery)
+  uint16_t stale_events;   // gaps longer than the signal's stale window
+  float rate_hz;           // accepted samples per second (0 once silent)
+  float last_raw;          // last decoded value, accepted or rejected
+  uint32_t last_ms;        // time of last_raw; 0 = never seen
+};
+
+class SignalHealth {
+ public:
+  static constexpr uint32_t kRateWindowMs = 1000;
+
+  SignalHealth();
+
+  // Writer side (DataStore only).
+  void clear();
+  void recordAccepted(SignalId id, float phys, uint32_t prev_ts_ms,
+                      uint16_t stale_ms, uint32_t now_ms);
+  void recordRejected(SignalId id, float phys, uint32_t now_ms);
+  void recordSuppressed(SignalId id);
+  void addInvalidMs(SignalId id, int32_t delta_ms);
+
+  void read(SignalHealthStats* out, size_t count, uint32_t now_ms) const;
+
+ private:
+  struct Entry {
+    SignalHealthStats stats;
+    uint32_t rate_start_ms;
+    uint32_t rate_base;
+  };
+
+  Entry entries_[static_cast<size_t>(SignalId::kCount)];
+};
@@ -0,0 +1,111 @@
+#include "data/signal_history.h"
+
+#include <math.h>
+#include <string.h>
+
+namespace {
+
+int16_t Quantize(float phys, float resolution) {
+  const float q = roundf(phys / resolution);
+  if (!(q == q)) return 0;  // NaN
+  if (q > 32767.0f) return 32767;
+  if (q < -32768.0f) return -32768;
+  return static_cast<int16_t>(q);
+}
+
+}  // namespace
+
+HistoryView::Iterator::Iterator(const HistoryView* view, uint8_t pos)
+    : view_(view), pos_(pos), cur_{view->newest_ts_ms_, 0.0f} {
+  if (pos_ < view_->count_) {
+    cur_.value = static_cast<float>(view_->entries_[pos_].raw) * view_->resolution_;
+  }
+}
+
+HistoryView::Iterator& HistoryView::Iterator::operator++() {
+  if (pos_ >= view_->count_) return *this;
+  cur_.ts_ms -= view_->entries_[pos_].dt_ms;
+  ++pos_;
+  if (pos_ < view_->count_) {
+    cur_.value = static_cast<float>(view_->entries_[pos_].raw) * view_->resolution_;
+  }
+  return *this;
+}
+
+SignalHistory::SignalHistory() : channel_count_(0), used_(0) {
+  memset(lookup_, 0, sizeof(lookup_));
+}
+
+bool SignalHistory::track(SignalId id, uint8_t capacity, float resolution) {
+  const size_t idx = static_cast<size_t>(id);
+  if (idx >= static_cast<size_t>(SignalId::kCount) || lookup_[idx] != 0) {
+    return false;
+  }
+  if (capacity == 0 || capacity > HistoryView::kMaxSamples ||
+      channel_count_ >= kMaxChannels || !(resolution > 0.0f) ||
+      (used_ + capacity) > kPoolEntries) {
+    return false;
+  }
+  Channel& ch = channels_[channel_count_];
+  ch.offset = used_;
+  ch.capacity = capacity;
+  ch.head = 0;
+  ch.count = 0;
+  ch.last_ts_ms = 0;
+  ch.resolution = resolution;
+  used_ = static_cast<uint16_t>(used_ + capacity);
+  ++channel_count_;
+  lookup_[idx] = channel_count_;
+  return true;
+}
+
+void SignalHistory::clear() {
+  for (uint8_t i = 0; i < channel_count_; ++i) {
+    channels_[i].head = 0;
+    channels_[i].count = 0;
+    channels_[i].last_ts_ms = 0;
+  }
+}
+
+bool SignalHistory::tracks(SignalId id) const { return channelIndex(id) >= 0; }
+
+int SignalHistory::channelIndex(SignalId id) const {
+  const size_t idx = static_cast<size_t>(id);
+  if (idx >= static_cast<size_t>(SignalId::kCount)) return -1;
+  return static_cast<int>(lookup_[idx]) - 1;
+}
+
+void SignalHistory::record(SignalId id, float phys, uint32_t ts_ms) {
+  const int ci = channelIndex(id);
+  if (ci < 0) return;
+  Channel* ch = &channels_[ci];
+  uint16_t dt = 0;
+  if (ch->count > 0) {
+    const uint32_t delta = ts_ms - ch->last_ts_ms;
+    dt = (delta > 0xFFFFu) ? static_cast<uint16_t>(0xFFFFu) : static_cast<uint16_t>(delta);
+  }
+  HistoryEntry& e = pool_[ch->offset + ch->head];
+  e.dt_ms = dt;
+  e.raw = Quantize(phys, ch->resolution);
+  ch->head = static_cast<uint8_t>((ch->head + 1) % ch->capacity);
+  if (ch->count < ch->capacity) {
+    ++ch->count;
+  }
+  ch->last_ts_ms = ts_ms;
+}
+
+bool SignalHistory::copy(SignalId id, HistoryView& out) const {
+  out.count_ = 0;
+  const int ci = channelIndex(id);
+  if (ci < 0) return false;
+  const Channel* ch = &channels_[ci];
+  out.newest_ts_ms_ = ch->last_ts_ms;
+  out.resolution_ = ch->resolution;
+  for (uint8_t k = 0; k < ch->count; ++k) {
+    const uint8_t slot =
+        static_cast<uint8_t>((ch->head + ch->capacity - 1 - k) % ch->capacity);
+    out.entries_[k] = pool_[ch->offset + slot];
+  }
+  out.count_ = ch->count;
+  return true;
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "data/datastore.h"
+
+// Short per-signal history (trend arrows, "value N s ago", blip detection).
+// Samples are 4 bytes: the time delta to the previous sample and the value
+// quantized to the channel resolution. All channels share one fixed pool.
+
+struct HistorySample {
+  uint32_t ts_ms;
+  float value;
+};
+
+struct HistoryEntry {
+  uint16_t dt_ms;  // to the previous (older) sample; saturates at ~65 s
+  int16_t raw;     // value / resolution
+};
+
+// Consistent newest-first copy of one channel, filled by
+// DataStore::readHistory(). Iterate with a range-for:
+//   for (const HistorySample& s : view) { ... }
+class HistoryView {
+ public:
+  static constexpr uint8_t kMaxSamples = 64;
+
+  class Iterator {
+   public:
+    const HistorySample& operator*() const { return cur_; }
+    const HistorySample* operator->() const { return &cur_; }
+    Iterator& operator++();
+    bool operator!=(const Iterator& o) const { return pos_ != o.pos_; }
+
+   private:
+    friend class HistoryView;
+    Iterator(const HistoryView* view, uint8_t pos);
+
+    const HistoryView* view_;
+    uint8_t pos_;
+    HistorySample cur_;
+  };
+
+  Iterator begin() const { return Iterator(this, 0); }
+  Iterator end() const { return Iterator(this, count_); }
+  uint8_t size() const { return count_; }
+  bool empty() const { return count_ == 0; }
+
+ private:
+  friend class SignalHistory;
+
+  HistoryEntry entries_[kMaxSamples];  // newest first
+  uint8_t count_ = 0;
+  uint32_t newest_ts_ms_ = 0;
+  float resolution_ = 1.0f;
+};
+
+// Writer side lives behind DataStore (attachHistory); record() runs inside the
+// store's sequence so readers get history and values from the same frame.
+class SignalHistory {
+ public:
+  static constexpr size_t kBudgetBytes = 1024;
+  static constexpr uint8_t kMaxChannels = 8;
+
+  SignalHistory();
+
+  // Boot-time: reserve `capacity` samples for a built-in signal. Fails when the
+  // budget, channel table or per-view limit would be exceeded.
+  bool track(SignalId id, uint8_t capacity, float resolution);
+  // Drops samples; channel layout is kept.
+  void clear();
+  bool tracks(SignalId id) const;
+  size_t bytesUsed() const { return used_ * sizeof(HistoryEntry); }
+
+  void record(SignalId id, float phys, uint32_t ts_ms);
+  bool copy(SignalId id, HistoryView& out) const;
+
+ private:
+  struct Channel {
+    uint16_t offset;
+    uint8_t capacity;
+    uint8_t head;
+    uint8_t count;
+    uint32_t last_ts_ms;
+    float resolution;
+  };
+  static constexpr size_t kPoolEntries = kBudgetBytes / sizeof(HistoryEntry);
+
+  int channelIndex(SignalId id) const;
+
+  Channel channels_[kMaxChannels];
+  uint8_t channel_count_;
+  uint8_t lookup_[static_cast<size_t>(SignalId::kCount)];  // channel + 1, 0 = none
+  HistoryEntry pool_[kPoolEntries];
+  uint16_t used_;
+};
@@ -0,0 +1,55 @@
+#include "data/signal_registry.h"
+
+SignalRegistry& SignalRegistry::instance() {
+  static SignalRegistry registry;
+  return registry;
+}
+
+SignalRegistry::SignalRegistry() : count_(0) { reset(); }
+
+void SignalRegistry::reset() {
+  const SignalLimits* defaults = DefaultSignalLimits();
+  for (size_t i = 0; i < kSignalCount; ++i) {
+    limits_[i] = defaults[i];
+  }
+  for (size_t i = 0; i < kMaxSignals - kSignalCount; ++i) {
+    extra_[i] = nullptr;
+  }
+  count_ = kSignalCount;
+}
+
+SignalId SignalRegistry::declare(const SignalChannelDesc& desc) {
+  if (count_ >= kMaxSignals) {
+    return kInvalidSignalId;
+  }
+  const size_t idx = count_;
+  extra_[idx - kSignalCount] = &desc;
+  limits_[idx].min = desc.min;
+  limits_[idx].max = desc.max;
+  count_ = idx + 1;
+  return static_cast<SignalId>(idx);
+}
+
+bool SignalRegistry::overrideLimits(SignalId id, float min, float max) {
+  const size_t idx = static_cast<size_t>(id);
+  if (idx >= count_ || !(min <= max)) {
+    return false;
+  }
+  limits_[idx].min = min;
+  limits_[idx].max = max;
+  return true;
+}
+
+const char* SignalRegistry::name(SignalId id) const {
+  const size_t idx = static_cast<size_t>(id);
+  if (idx < kSignalCount) return LookupSignalContract(id)->name;
+  if (idx < count_) return extra_[idx - kSignalCount]->name;
+  return "";
+}
+
+const char* SignalRegistry::unit(SignalId id) const {
+  const size_t idx = static_cast<size_t>(id);
+  if (idx < kSignalCount) return LookupSignalContract(id)->unit;
+  if (idx < count_) return extra_[idx - kSignalCount]->unit;
+  return "";
+}
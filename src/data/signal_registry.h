@@ -0,0 +1,53 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "data/signal_contract.h"
+
+// Channel description supplied by an ECU profile for signals beyond the
+// built-in SignalId set. `name`/`unit` must point to static storage.
+struct SignalChannelDesc {
+  const char* name;
+  const char* unit;
+  float min;
+  float max;
+};
+
+constexpr SignalId kInvalidSignalId = static_cast<SignalId>(0xFF);
+
+// Runtime list of known signals. Ids 0..kCount-1 are the built-in contract
+// channels; profiles append extra channels at boot (before the CAN task and
+// DataStore::resize) and receive SignalId values >= kCount. Read-only after
+// boot, so lookups need no locking.
+class SignalRegistry {
+ public:
+  // Built-ins + full MS3 advanced broadcast with headroom.
+  static constexpr size_t kMaxSignals = 96;
+
+  static SignalRegistry& instance();
+
+  // Drops profile channels and restores contract limits.
+  void reset();
+  // Returns the new id, or kInvalidSignalId when the registry is full.
+  SignalId declare(const SignalChannelDesc& desc);
+  // Profile override of plausibility bounds (built-in or declared ids).
+  bool overrideLimits(SignalId id, float min, float max);
+
+  size_t count() const { return count_; }
+  bool contains(SignalId id) const { return static_cast<size_t>(id) < count_; }
+  const char* name(SignalId id) const;
+  const char* unit(SignalId id) const;
+  // Dense plausibility table, count() entries.
+  const SignalLimits* limits() const { return limits_; }
+
+ private:
+  SignalRegistry();
+
+  static_assert(kMaxSignals < 0xFF, "0xFF is reserved for kInvalidSignalId");
+  static_assert(kMaxSignals >= kSignalCount, "registry must hold built-ins");
+
+  const SignalChannelDesc* extra_[kMaxSignals - kSignalCount];
+  SignalLimits limits_[kMaxSignals];
+  size_t count_;
+};
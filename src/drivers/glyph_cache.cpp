@@ -0,0 +1,209 @@
+#include "drivers/glyph_cache.h"
+
+#include <string.h>
+
+namespace {
+
+constexpr char kCachedChars[GlyphCache::kCharCount + 1] = "0123456789-+.";
+
+int8_t CharIndex(char ch) {
+  const char* p = strchr(kCachedChars, ch);
+  return (ch != '\0' && p) ? static_cast<int8_t>(p - kCachedChars) : -1;
+}
+
+uint64_t LoadColumn(const uint8_t* bytes, uint8_t pages) {
+  uint64_t bits = 0;
+  for (uint8_t p = 0; p < pages; ++p) {
+    bits |= static_cast<uint64_t>(bytes[p]) << (8 * p);
+  }
+  return bits;
+}
+
+uint64_t LoadColumnAt(const uint8_t* canvas, int16_t col) {
+  uint64_t bits = 0;
+  for (uint8_t p = 0; p < GlyphCache::kCanvasPages; ++p) {
+    bits |= static_cast<uint64_t>(canvas[p * GlyphCache::kCanvasW + col]) << (8 * p);
+  }
+  return bits;
+}
+
+uint64_t ReverseBits(uint64_t v) {
+  v = ((v >> 1) & 0x5555555555555555ULL) | ((v & 0x5555555555555555ULL) << 1);
+  v = ((v >> 2) & 0x3333333333333333ULL) | ((v & 0x3333333333333333ULL) << 2);
+  v = ((v >> 4) & 0x0F0F0F0F0F0F0F0FULL) | ((v & 0x0F0F0F0F0F0F0F0FULL) << 4);
+  v = ((v >> 8) & 0x00FF00FF00FF00FFULL) | ((v & 0x00FF00FF00FF00FFULL) << 8);
+  v = ((v >> 16) & 0x0000FFFF0000FFFFULL) | ((v & 0x0000FFFF0000FFFFULL) << 16);
+  return (v >> 32) | (v << 32);
+}
+
+// Applies `bits` (bit 0 = row `top`) to one frame column.
+void ApplyColumn(uint8_t* frame, uint8_t tiles_w, uint8_t tiles_h, int16_t col, int16_t top,
+                 uint8_t rows, uint64_t bits, uint8_t color) {
+  if (bits == 0) return;
+  const int16_t bottom = static_cast<int16_t>(top + rows - 1);
+  int16_t first = top >> 3;
+  int16_t last = bottom >> 3;
+  if (first < 0) first = 0;
+  if (last >= tiles_h) last = static_cast<int16_t>(tiles_h - 1);
+  const size_t stride = static_cast<size_t>(tiles_w) * 8;
+  for (int16_t page = first; page <= last; ++page) {
+    const int16_t shift = static_cast<int16_t>(page * 8 - top);
+    uint8_t b;
+    if (shift >= 64) {
+      continue;
+    } else if (shift >= 0) {
+      b = static_cast<uint8_t>(bits >> shift);
+    } else {
+      b = static_cast<uint8_t>(bits << -shift);
+    }
+    if (b == 0) continue;
+    uint8_t& dst = frame[page * stride + col];
+    switch (color) {
+      case 0:
+        dst = static_cast<uint8_t>(dst & ~b);
+        break;
+      case 1:
+        dst = static_cast<uint8_t>(dst | b);
+        break;
+      default:
+        dst = static_cast<uint8_t>(dst ^ b);
+        break;
+    }
+  }
+}
+
+}  // namespace
+
+void BlitGlyph(uint8_t* frame, uint8_t tiles_w, uint8_t tiles_h, const CachedGlyph& g,
+               const uint8_t* fg, const uint8_t* bg, int16_t x, int16_t y, uint8_t draw_color,
+               bool flip_180) {
+  if (g.w == 0 || g.h == 0) return;
+  const int16_t width = static_cast<int16_t>(tiles_w * 8);
+  const int16_t height = static_cast<int16_t>(tiles_h * 8);
+  const uint8_t pages = static_cast<uint8_t>((g.h + 7) / 8);
+  int16_t left = static_cast<int16_t>(x + g.x0);
+  int16_t top = static_cast<int16_t>(y + g.y0);
+  if (flip_180) {
+    // U8G2_R2 puts logical (x, y) at (width-1-x, height-1-y): the bbox moves
+    // and its pixels turn around.
+    left = static_cast<int16_t>(width - 1 - x - (g.x0 + g.w - 1));
+    top = static_cast<int16_t>(height - 1 - y - (g.y0 + g.h - 1));
+  }
+  const uint8_t bg_color = (draw_color == 0) ? 1 : 0;
+  for (uint8_t c = 0; c < g.w; ++c) {
+    const int16_t col = static_cast<int16_t>(left + c);
+    if (col < 0 || col >= width) continue;
+    const uint8_t src = flip_180 ? static_cast<uint8_t>(g.w - 1 - c) : c;
+    uint64_t fg_bits = LoadColumn(fg + src * pages, pages);
+    uint64_t bg_bits = (g.has_bg && bg) ? LoadColumn(bg + src * pages, pages) : 0;
+    if (flip_180) {
+      fg_bits = ReverseBits(fg_bits) >> (64 - g.h);
+      bg_bits = ReverseBits(bg_bits) >> (64 - g.h);
+    }
+    // U8g2 draws each run once, so a pixel is either foreground or background.
+    ApplyColumn(frame, tiles_w, tiles_h, col, top, g.h, bg_bits, bg_color);
+    ApplyColumn(frame, tiles_w, tiles_h, col, top, g.h, fg_bits, draw_color);
+  }
+}
+
+const GlyphCache::FontEntry* GlyphCache::find(const void* font) const {
+  for (uint8_t i = 0; i < font_count_; ++i) {
+    if (fonts_[i].font == font) return &fonts_[i];
+  }
+  return nullptr;
+}
+
+bool GlyphCache::loaded(const void* font) const {
+  const FontEntry* entry = find(font);
+  return entry && entry->ok;
+}
+
+bool GlyphCache::load(const void* font, GlyphRasterFn raster, void* ctx) {
+  if (const FontEntry* entry = find(font)) return entry->ok;
+  if (font_count_ >= kMaxFonts || !raster) return false;
+  FontEntry& entry = fonts_[font_count_++];
+  entry.font = font;
+  entry.ok = false;
+  const size_t pool_mark = pool_used_;
+  for (uint8_t i = 0; i < kCharCount; ++i) {
+    if (!capture(entry, i, kCachedChars[i], raster, ctx)) {
+      pool_used_ = pool_mark;
+      return false;
+    }
+  }
+  entry.ok = true;
+  return true;
+}
+
+bool GlyphCache::capture(FontEntry& entry, uint8_t index, char ch, GlyphRasterFn raster,
+                         void* ctx) {
+  memset(canvas_fg_, 0, sizeof(canvas_fg_));
+  memset(canvas_bg_, 0, sizeof(canvas_bg_));
+  const int16_t advance = raster(ctx, entry.font, ch, 1, canvas_fg_);
+  // Color 0 on a cleared canvas leaves only the solid-mode background.
+  raster(ctx, entry.font, ch, 0, canvas_bg_);
+  if (advance < -128 || advance > 127) return false;
+
+  int16_t col_min = kCanvasW;
+  int16_t col_max = -1;
+  uint64_t rows_any = 0;
+  bool any_bg = false;
+  for (int16_t c = 0; c < kCanvasW; ++c) {
+    const uint64_t fg_bits = LoadColumnAt(canvas_fg_, c);
+    const uint64_t bg_bits = LoadColumnAt(canvas_bg_, c);
+    if ((fg_bits | bg_bits) == 0) continue;
+    if (c < col_min) col_min = c;
+    col_max = c;
+    rows_any |= fg_bits | bg_bits;
+    any_bg = any_bg || (bg_bits != 0);
+  }
+  CachedGlyph& g = entry.glyph[index];
+  g = CachedGlyph{};
+  g.advance = static_cast<int8_t>(advance);
+  if (col_max < 0) return true;  // no pixels (space-like or missing glyph)
+
+  uint8_t row_min = 0;
+  while (!(rows_any & (1ULL << row_min))) ++row_min;
+  uint8_t row_max = 63;
+  while (!(rows_any & (1ULL << row_max))) --row_max;
+  g.x0 = static_cast<int8_t>(col_min - kOriginX);
+  g.y0 = static_cast<int8_t>(row_min - kOriginY);
+  g.w = static_cast<uint8_t>(col_max - col_min + 1);
+  g.h = static_cast<uint8_t>(row_max - row_min + 1);
+  g.has_bg = any_bg;
+  const uint8_t pages = static_cast<uint8_t>((g.h + 7) / 8);
+  const size_t plane = static_cast<size_t>(g.w) * pages;
+  const size_t need = any_bg ? plane * 2 : plane;
+  if (pool_used_ + need > kPoolBytes) return false;
+  g.offset = static_cast<uint16_t>(pool_used_);
+  uint8_t* fg = pool_ + pool_used_;
+  uint8_t* bg = fg + plane;
+  for (uint8_t c = 0; c < g.w; ++c) {
+    const uint64_t fg_bits = LoadColumnAt(canvas_fg_, col_min + c) >> row_min;
+    const uint64_t bg_bits = LoadColumnAt(canvas_bg_, col_min + c) >> row_min;
+    for (uint8_t p = 0; p < pages; ++p) {
+      fg[c * pages + p] = static_cast<uint8_t>(fg_bits >> (8 * p));
+      if (any_bg) bg[c * pages + p] = static_cast<uint8_t>(bg_bits >> (8 * p));
+    }
+  }
+  pool_used_ += need;
+  return true;
+}
+
+bool GlyphCache::drawStr(const void* font, const char* s, uint8_t* frame, uint8_t tiles_w,
+                         uint8_t tiles_h, int16_t x, int16_t y, uint8_t draw_color,
+                         bool flip_180) const {
+  const FontEntry* entry = find(font);
+  if (!entry || !entry->ok || !s || !frame) return false;
+  for (const char* p = s; *p; ++p) {
+    if (CharIndex(*p) < 0) return false;
+  }
+  for (const char* p = s; *p; ++p) {
+    const CachedGlyph& g = entry->glyph[CharIndex(*p)];
+    const uint8_t* fg = pool_ + g.offset;
+    const uint8_t* bg = fg + static_cast<size_t>(g.w) * ((g.h + 7) / 8);
+    BlitGlyph(frame, tiles_w, tiles_h, g, fg, bg, x, y, draw_color, flip_180);
+    x = static_cast<int16_t>(x + g.advance);
+  }
+  return true;
+}
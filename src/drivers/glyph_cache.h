@@ -0,0 +1,73 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Pre-rasterized big-value glyphs. U8g2 decodes its run-length compressed
+// glyph data on every drawStr; this cache captures each digit, sign and
+// decimal point once (rendered by U8g2 itself, see GlyphRasterFn) as
+// page-aligned column bytes in the U8g2/SSD1306 buffer layout and blits
+// them straight into the frame buffer.
+
+// Draws `ch` with `draw_color` at (GlyphCache::kOriginX, GlyphCache::kOriginY)
+// into a cleared R0 canvas of GlyphCache::kCanvasPages x 128 bytes (U8g2
+// full-buffer layout). Returns the x advance drawStr would apply.
+typedef int16_t (*GlyphRasterFn)(void* ctx, const void* font, char ch, uint8_t draw_color,
+                                 uint8_t* canvas);
+
+struct CachedGlyph {
+  int8_t x0;  // bbox left/top relative to the draw origin (R0 pixels)
+  int8_t y0;
+  uint8_t w;
+  uint8_t h;
+  int8_t advance;
+  bool has_bg;      // solid font mode: background pixels inside the bbox
+  uint16_t offset;  // into the pool: fg column bytes, then bg column bytes
+};
+
+// Writes one glyph into a full-buffer frame: foreground pixels with
+// `draw_color` (0 clear, 1 set, 2 xor), solid-mode background pixels with
+// the opposite color, clipped to the frame. `flip_180` maps like U8G2_R2.
+void BlitGlyph(uint8_t* frame, uint8_t tiles_w, uint8_t tiles_h, const CachedGlyph& g,
+               const uint8_t* fg, const uint8_t* bg, int16_t x, int16_t y, uint8_t draw_color,
+               bool flip_180);
+
+class GlyphCache {
+ public:
+  static constexpr uint8_t kMaxFonts = 4;
+  static constexpr uint8_t kCharCount = 13;
+  static constexpr size_t kPoolBytes = 16384;
+  static constexpr uint8_t kCanvasPages = 8;  // glyphs up to 64 rows
+  static constexpr int16_t kCanvasW = 128;
+  static constexpr int16_t kOriginX = 32;
+  static constexpr int16_t kOriginY = 48;  // baseline; 48 rows above, 16 below
+
+  // Rasterizes the cached character set of `font` (once; a font that does
+  // not fit is remembered and never retried). False when unavailable.
+  bool load(const void* font, GlyphRasterFn raster, void* ctx);
+  bool loaded(const void* font) const;
+  // True once load() ran for `font`, whether or not it succeeded.
+  bool known(const void* font) const { return find(font) != nullptr; }
+  // drawStr equivalent for `font`; false (nothing drawn) if the font is not
+  // loaded or `s` has a character outside the cached set.
+  bool drawStr(const void* font, const char* s, uint8_t* frame, uint8_t tiles_w,
+               uint8_t tiles_h, int16_t x, int16_t y, uint8_t draw_color,
+               bool flip_180) const;
+  size_t poolUsed() const { return pool_used_; }
+
+ private:
+  struct FontEntry {
+    const void* font;
+    bool ok;
+    CachedGlyph glyph[kCharCount];
+  };
+  const FontEntry* find(const void* font) const;
+  bool capture(FontEntry& entry, uint8_t index, char ch, GlyphRasterFn raster, void* ctx);
+
+  FontEntry fonts_[kMaxFonts] = {};
+  uint8_t font_count_ = 0;
+  size_t pool_used_ = 0;
+  uint8_t pool_[kPoolBytes];
+  uint8_t canvas_fg_[kCanvasPages * kCanvasW];
+  uint8_t canvas_bg_[kCanvasPages * kCanvasW];
+};
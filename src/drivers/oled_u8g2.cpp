@@ -8,6 +8,10 @@
 
 #include "app_config.h"
 #include "config/factory_config.h"
+#include "drivers/glyph_cache.h"
+#include "drivers/sw_i2c.h"
+#include "drivers/text_metrics.h"
+#include "drivers/tile_diff.h"
 
 namespace {
 constexpr uint8_t kI2cAddress = 0x3C << 1;  // U8G2 uses 8-bit addr
@@ -16,6 +20,19 @@ constexpr uint8_t kI2cAddr7Alt = 0x3D;
 
 static uint32_t g_sw_i2c_delay_us = 5;
 
+// SSD1306 page/column addressing per updateDisplayArea() row run, including
+// the extra I2C address/control bytes of the command transfer.
+constexpr uint32_t kTileRunOverheadBytes = 6;
+constexpr uint8_t kMaxTileRuns = 32;
+// Tile-diffed transfers only resend what changed, so a transfer garbled on
+// the bus would stay on the panel over static content; the whole frame goes
+// out again at least this often.
+constexpr uint32_t kFullRefreshMs = 5000;
+
+// Big-value digit glyphs, shared by both displays (main loop only).
+GlyphCache g_big_glyphs;
+TextMetrics g_text_metrics;
+
 inline uint32_t ClampDelayUs(uint32_t us) {
   if (us == 0) return 1;
   if (us > 1000U) return 1000U;
@@ -28,88 +45,53 @@ inline uint32_t CalcSwDelayUs(uint32_t bus_hz) {
   return ClampDelayUs(half_us);
 }
 
-inline void I2cDelayShort() { delayMicroseconds(GetSwI2cDelayUs()); }
-
-inline void I2cSclLow(uint8_t scl) {
-  pinMode(scl, OUTPUT);
-  digitalWrite(scl, LOW);
-}
-
-inline void I2cSclRelease(uint8_t scl) {
-  pinMode(scl, INPUT_PULLUP);
-}
-
-inline void I2cSdaLow(uint8_t sda) {
-  pinMode(sda, OUTPUT);
-  digitalWrite(sda, LOW);
-}
-
-inline void I2cSdaRelease(uint8_t sda) {
-  pinMode(sda, INPUT_PULLUP);
-}
-
-inline bool I2cSdaRead(uint8_t sda) {
-  pinMode(sda, INPUT_PULLUP);
-  return digitalRead(sda) != 0;
-}
-
-inline void I2cStart(uint8_t sda, uint8_t scl) {
-  I2cSdaRelease(sda);
-  I2cSclRelease(scl);
-  I2cDelayShort();
-  I2cSdaLow(sda);
-  I2cDelayShort();
-  I2cSclLow(scl);
-  I2cDelayShort();
-}
-
-inline void I2cStop(uint8_t sda, uint8_t scl) {
-  I2cSdaLow(sda);
-  I2cDelayShort();
-  I2cSclRelease(scl);
-  I2cDelayShort();
-  I2cSdaRelease(sda);
-  I2cDelayShort();
+bool I2cSendAddressSw(SwI2c& bus, uint8_t addr7) {
+  bus.start();
+  const bool ack = bus.writeByte(static_cast<uint8_t>(addr7 << 1));
+  bus.stop();
+  return ack;
 }
 
-inline bool I2cWriteByte(uint8_t sda, uint8_t scl, uint8_t data) {
-  for (uint8_t i = 0; i < 8; ++i) {
-    if (data & 0x80) {
-      I2cSdaRelease(sda);
-    } else {
-      I2cSdaLow(sda);
-    }
-    I2cDelayShort();
-    I2cSclRelease(scl);
-    I2cDelayShort();
-    I2cSclLow(scl);
-    I2cDelayShort();
-    data <<= 1;
-  }
-  I2cSdaRelease(sda);
-  I2cDelayShort();
-  I2cSclRelease(scl);
-  I2cDelayShort();
-  const bool nack = I2cSdaRead(sda);
-  I2cSclLow(scl);
-  I2cDelayShort();
-  return !nack;
-}
-
-bool I2cSendCommandSw(uint8_t sda, uint8_t scl, uint8_t addr7, uint8_t cmd) {
-  bool ack = false;
-  I2cStart(sda, scl);
-  ack = I2cWriteByte(sda, scl, static_cast<uint8_t>(addr7 << 1));
+bool I2cSendCommandSw(SwI2c& bus, uint8_t addr7, uint8_t cmd) {
+  bus.start();
+  bool ack = bus.writeByte(static_cast<uint8_t>(addr7 << 1));
   if (ack) {
-    ack = I2cWriteByte(sda, scl, 0x00);  // control byte: command
+    ack = bus.writeByte(0x00);  // control byte: command
   }
   if (ack) {
-    ack = I2cWriteByte(sda, scl, cmd);
+    ack = bus.writeByte(cmd);
   }
-  I2cStop(sda, scl);
+  bus.stop();
   return ack;
 }
 
+// U8g2 byte callback for Bus::kSw displays; user_ptr is the OledU8g2's SwI2c.
+uint8_t SwI2cByteCb(u8x8_t* u8x8, uint8_t msg, uint8_t arg_int, void* arg_ptr) {
+  SwI2c* bus = static_cast<SwI2c*>(u8x8_GetUserPtr(u8x8));
+  switch (msg) {
+    case U8X8_MSG_BYTE_INIT:
+    case U8X8_MSG_BYTE_SET_DC:
+      break;
+    case U8X8_MSG_BYTE_START_TRANSFER:
+      bus->start();
+      bus->writeByte(u8x8_GetI2CAddress(u8x8));
+      break;
+    case U8X8_MSG_BYTE_SEND: {
+      const uint8_t* data = static_cast<const uint8_t*>(arg_ptr);
+      for (uint8_t i = 0; i < arg_int; ++i) {
+        bus->writeByte(data[i]);
+      }
+      break;
+    }
+    case U8X8_MSG_BYTE_END_TRANSFER:
+      bus->stop();
+      break;
+    default:
+      return 0;
+  }
+  return 1;
+}
+
 // Draw an alert triangle with an exclamation point. x_right is the right edge
 // of the icon; y_top is the top; height controls size. draw_black forces
 // drawing in black (useful when the buffer is inverted via XOR).
@@ -156,8 +138,26 @@ OledU8g2::OledU8g2(Bus bus, uint8_t clock_pin, uint8_t data_pin,
       reset_pin_(reset_pin),
       ready_(false),
       bus_hz_(0),
+      sw_i2c_(data_pin, clock_pin),
       u8g2_(nullptr),
-      invert_on_(false) {}
+      invert_on_(false),
+      flash_on_(false),
+      hw_invert_(false),
+      flip_180_(false),
+      shadow_valid_(false),
+      shadow_(),
+      shown_seq_(0),
+      frame_epoch_(0),
+      last_full_ms_(0),
+      async_(false),
+      back_pending_(false),
+      back_tiles_w_(0),
+      back_tiles_h_(0),
+      back_(frame_bufs_[0]),
+      front_(frame_bufs_[1]),
+      frame_bufs_(),
+      blocked_us_(0),
+      io_lock_(xSemaphoreCreateRecursiveMutex()) {}
 
 void OledU8g2::destroyDisplay() {
   if (u8g2_) {
@@ -167,10 +167,13 @@ void OledU8g2::destroyDisplay() {
 }
 
 bool OledU8g2::begin(uint32_t bus_hz, Profile profile, bool probe_hw) {
+  IoLock lock(*this);
+  back_pending_ = false;
   ready_ = false;
   destroyDisplay();
   if (bus_ == Bus::kSw && bus_hz > 0) {
     SetSwI2cDelayUs(CalcSwDelayUs(bus_hz));
+    sw_i2c_.setClockHz(bus_hz);
   }
   if (probe_hw && !probeBusAddress()) {
     return false;
@@ -193,15 +196,21 @@ bool OledU8g2::begin(uint32_t bus_hz, Profile profile, bool probe_hw) {
   u8g2_->begin();
   u8g2_->setPowerSave(0);
   invert_on_ = false;
+  flash_on_ = false;
+  hw_invert_ = false;
+  invalidateShadow();
   ready_ = true;
   return ready_;
 }
 
 bool OledU8g2::begin64(uint32_t bus_hz, bool probe_hw) {
+  IoLock lock(*this);
+  back_pending_ = false;
   ready_ = false;
   destroyDisplay();
   if (bus_ == Bus::kSw && bus_hz > 0) {
     SetSwI2cDelayUs(CalcSwDelayUs(bus_hz));
+    sw_i2c_.setClockHz(bus_hz);
   }
   if (probe_hw && !probeBusAddress()) {
     return false;
@@ -221,6 +230,9 @@ bool OledU8g2::begin64(uint32_t bus_hz, bool probe_hw) {
   u8g2_->begin();
   u8g2_->setPowerSave(0);
   invert_on_ = false;
+  flash_on_ = false;
+  hw_invert_ = false;
+  invalidateShadow();
   ready_ = true;
   return ready_;
 }
@@ -233,6 +245,7 @@ void OledU8g2::setSleep(bool sleep_on) {
   if (!ready_) {
     return;
   }
+  IoLock lock(*this);
   u8g2_->setPowerSave(sleep_on ? 1 : 0);
 }
 
@@ -241,17 +254,30 @@ void OledU8g2::setRotation(bool flip_180) {
     return;
   }
   u8g2_->setDisplayRotation(flip_180 ? U8G2_R2 : U8G2_R0);
+  flip_180_ = flip_180;
 }
 
 void OledU8g2::setInvert(bool on) {
+  invert_on_ = on;
+  applyInvert();
+}
+
+void OledU8g2::setFlash(bool on) {
+  flash_on_ = on;
+  applyInvert();
+}
+
+void OledU8g2::applyInvert() {
   if (!ready_) {
     return;
   }
-  if (invert_on_ == on) {
+  const bool on = invert_on_ != flash_on_;
+  if (hw_invert_ == on) {
     return;
   }
+  IoLock lock(*this);
   u8g2_->sendF("c", on ? 0xA7 : 0xA6);
-  invert_on_ = on;
+  hw_invert_ = on;
 }
 
 void OledU8g2::ensureFonts() {
@@ -269,13 +295,15 @@ void OledU8g2::createDisplay(Profile profile) {
           U8G2_SSD1306_128X32_WINSTAR_F_HW_I2C(U8G2_R0, reset_pin_);
     }
   } else {
+    u8g2_ = new (storage_) U8G2();
     if (profile == Profile::kUnivision) {
-      u8g2_ = new (storage_) U8G2_SSD1306_128X32_UNIVISION_F_SW_I2C(
-          U8G2_R0, clock_pin_, data_pin_, reset_pin_);
+      u8g2_Setup_ssd1306_i2c_128x32_univision_f(u8g2_->getU8g2(), U8G2_R0, SwI2cByteCb,
+                                                u8x8_gpio_and_delay_arduino);
     } else {
-      u8g2_ = new (storage_) U8G2_SSD1306_128X32_WINSTAR_F_SW_I2C(
-          U8G2_R0, clock_pin_, data_pin_, reset_pin_);
+      u8g2_Setup_ssd1306_i2c_128x32_winstar_f(u8g2_->getU8g2(), U8G2_R0, SwI2cByteCb,
+                                              u8x8_gpio_and_delay_arduino);
     }
+    attachSwBus();
   }
 }
 
@@ -284,11 +312,20 @@ void OledU8g2::createDisplay64() {
   if (bus_ == Bus::kHw) {
     u8g2_ = new (storage_) U8G2_SSD1306_128X64_NONAME_F_HW_I2C(U8G2_R0, reset_pin_);
   } else {
-    u8g2_ = new (storage_) U8G2_SSD1306_128X64_NONAME_F_SW_I2C(U8G2_R0, clock_pin_,
-                                                               data_pin_, reset_pin_);
+    u8g2_ = new (storage_) U8G2();
+    u8g2_Setup_ssd1306_i2c_128x64_noname_f(u8g2_->getU8g2(), U8G2_R0, SwI2cByteCb,
+                                           u8x8_gpio_and_delay_arduino);
+    attachSwBus();
   }
 }
 
+void OledU8g2::attachSwBus() {
+  u8x8_t* u8x8 = u8g2_->getU8x8();
+  u8x8_SetPin(u8x8, U8X8_PIN_RESET, static_cast<uint8_t>(reset_pin_));
+  u8x8_SetUserPtr(u8x8, &sw_i2c_);
+  sw_i2c_.begin();
+}
+
 bool OledU8g2::probeHwAddress() {
   if (bus_ != Bus::kHw) {
     return true;
@@ -301,22 +338,11 @@ bool OledU8g2::probeSwAddress() {
   if (bus_ != Bus::kSw) {
     return true;
   }
-  const uint8_t sda = data_pin_;
-  const uint8_t scl = clock_pin_;
-  I2cSdaRelease(sda);
-  I2cSclRelease(scl);
-  I2cDelayShort();
-  bool ack = false;
-  I2cStart(sda, scl);
-  ack = I2cWriteByte(sda, scl, static_cast<uint8_t>(kI2cAddr7Primary << 1));
-  I2cStop(sda, scl);
+  sw_i2c_.begin();
+  bool ack = I2cSendAddressSw(sw_i2c_, kI2cAddr7Primary);
   if (!ack) {
-    I2cStart(sda, scl);
-    ack = I2cWriteByte(sda, scl, static_cast<uint8_t>(kI2cAddr7Alt << 1));
-    I2cStop(sda, scl);
+    ack = I2cSendAddressSw(sw_i2c_, kI2cAddr7Alt);
   }
-  I2cSdaRelease(sda);
-  I2cSclRelease(scl);
   return ack;
 }
 
@@ -325,6 +351,7 @@ bool OledU8g2::probeBusAddress() {
 }
 
 bool OledU8g2::probeAddress() {
+  IoLock lock(*this);
   const bool ok = probeBusAddress();
   const uint8_t oled_id = (bus_ == Bus::kHw) ? 1 : 2;
   I2cOledLogEvent(oled_id, I2cOledAction::kProbe, ok, data_pin_, clock_pin_);
@@ -332,6 +359,7 @@ bool OledU8g2::probeAddress() {
 }
 
 bool OledU8g2::sendRawCommand(uint8_t cmd) {
+  IoLock lock(*this);
   if (bus_ == Bus::kHw) {
     Wire.beginTransmission(kI2cAddr7Primary);
     Wire.write(0x00);
@@ -344,18 +372,18 @@ bool OledU8g2::sendRawCommand(uint8_t cmd) {
     Wire.write(cmd);
     return Wire.endTransmission() == 0;
   }
-  const uint8_t sda = data_pin_;
-  const uint8_t scl = clock_pin_;
-  if (I2cSendCommandSw(sda, scl, kI2cAddr7Primary, cmd)) {
+  if (I2cSendCommandSw(sw_i2c_, kI2cAddr7Primary, cmd)) {
     return true;
   }
-  return I2cSendCommandSw(sda, scl, kI2cAddr7Alt, cmd);
+  return I2cSendCommandSw(sw_i2c_, kI2cAddr7Alt, cmd);
 }
 
 void OledU8g2::setBusClockHz(uint32_t bus_hz) {
+  IoLock lock(*this);
   bus_hz_ = bus_hz;
   if (bus_ == Bus::kSw && bus_hz > 0) {
     SetSwI2cDelayUs(CalcSwDelayUs(bus_hz));
+    sw_i2c_.setClockHz(bus_hz);
   }
   if (bus_ == Bus::kHw) {
     Wire.setClock(bus_hz);
@@ -432,39 +460,56 @@ void OledU8g2::renderMetric(const char* label, const char* value_str,
   }
 
   const uint8_t* chosen_font = error_fonts[1];
-  if (has_error_value) {
-    for (uint8_t i = 0; i < 2; ++i) {
-      u8g2_->setFont(error_fonts[i]);
-      int16_t ascent = u8g2_->getAscent();
-      int16_t descent = u8g2_->getDescent();
-      int16_t h = ascent - descent;
-      int16_t w = u8g2_->getStrWidth(value);
-      if (h <= effective_h && w <= display_w) {
-        chosen_font = error_fonts[i];
-        break;
-      }
-    }
+  int16_t ascent = 0;
+  int16_t descent = 0;
+  int16_t w = 0;
+  // Steady state: a value of the same shape in the same viewport lands on
+  // the same font, as long as every font tried has uniform digit widths.
+  FitMemo& memo = fit_memo_[viewport_y > 0 ? 1 : 0];
+  char shape[sizeof(memo.shape)];
+  const bool shape_ok = has_error_value
+                            ? strlcpy(shape, value, sizeof(shape)) < sizeof(shape)
+                            : ValueShape(value, shape, sizeof(shape));
+  if (shape_ok && memo.font && memo.error == has_error_value &&
+      memo.effective_h == effective_h && memo.display_w == display_w &&
+      strcmp(memo.shape, shape) == 0) {
+    chosen_font = memo.font;
+    ascent = memo.ascent;
+    descent = memo.descent;
+    w = memo.width;
   } else {
-    uint8_t chosen = order[3];  // fallback to smallest in order
-    for (uint8_t i = 0; i < 4; ++i) {
-      const uint8_t idx = order[i];
-      u8g2_->setFont(fonts[idx]);
-      int16_t ascent = u8g2_->getAscent();
-      int16_t descent = u8g2_->getDescent();
-      int16_t h = ascent - descent;
-      int16_t w = u8g2_->getStrWidth(value);
-      if (h <= effective_h && w <= display_w) {
-        chosen = idx;
+    bool uniform = true;
+    bool fitted = false;
+    const uint8_t* const* candidates = has_error_value ? error_fonts : fonts;
+    const uint8_t candidate_count = has_error_value ? 2 : 4;
+    for (uint8_t i = 0; i < candidate_count; ++i) {
+      const uint8_t* font = has_error_value ? candidates[i] : candidates[order[i]];
+      measureText(font, value, ascent, descent, w);
+      uniform = uniform && g_text_metrics.uniformDigits(font);
+      if ((ascent - descent) <= effective_h && w <= display_w) {
+        chosen_font = font;
+        fitted = true;
         break;
       }
     }
-    chosen_font = fonts[chosen];
+    if (!fitted) {
+      // Fallback: last error font, or the smallest big font in order.
+      chosen_font = has_error_value ? error_fonts[1] : fonts[order[3]];
+      measureText(chosen_font, value, ascent, descent, w);
+    }
+    memo.font = nullptr;
+    if (shape_ok && (has_error_value || uniform)) {
+      memo.font = chosen_font;
+      memo.error = has_error_value;
+      memo.effective_h = effective_h;
+      memo.display_w = display_w;
+      memcpy(memo.shape, shape, sizeof(memo.shape));
+      memo.ascent = ascent;
+      memo.descent = descent;
+      memo.width = w;
+    }
   }
-
   u8g2_->setFont(chosen_font);
-  int16_t ascent = u8g2_->getAscent();
-  int16_t descent = u8g2_->getDescent();
-  int16_t w = u8g2_->getStrWidth(value);
   const int16_t baseline_base = (effective_h - 1) + descent;  // bottom-safe baseline
   const int8_t nudge = has_error_value ? AppConfig::kErrorValueBaselineNudgePx
                                        : AppConfig::kBigValueBaselineNudgePx;
@@ -484,7 +529,12 @@ void OledU8g2::renderMetric(const char* label, const char* value_str,
   u8g2_->setFont(chosen_font);
   const int16_t big_value_y =
       static_cast<int16_t>(baseline_y + 1 + static_cast<int16_t>(viewport_y));  // UX tweak
-  u8g2_->drawStr(x, big_value_y, value);
+  if (has_error_value) {
+    u8g2_->drawStr(x, big_value_y, value);
+  } else {
+    drawBigValue(chosen_font, x, big_value_y, value,
+                 invert_zone ? 0 : (crit_global ? 2 : 1));
+  }
   // Small elements
   u8g2_->setFont(u8g2_font_6x12_tr);
   const int16_t label_y = 11 + static_cast<int16_t>(viewport_y) - 2;
@@ -569,7 +619,208 @@ void OledU8g2::renderMetric(const char* label, const char* value_str,
   }
 
   if (send_buffer) {
+    sendFrame();
+  }
+}
+
+// Same pixels as drawStr with the current font/draw color, from the glyph
+// cache when every character is cached. A font is rasterized on first use
+// through U8g2 itself, borrowing the frame buffer (saved and restored).
+void OledU8g2::drawBigValue(const uint8_t* font, int16_t x, int16_t y, const char* value,
+                            uint8_t draw_color) {
+  uint8_t* frame = u8g2_->getBufferPtr();
+  const uint8_t tiles_w = u8g2_->getBufferTileWidth();
+  const uint8_t tiles_h = u8g2_->getBufferTileHeight();
+  const size_t frame_bytes = static_cast<size_t>(tiles_w) * tiles_h * 8;
+  const bool cacheable = tiles_w * 8 == GlyphCache::kCanvasW && frame_bytes <= kFrameBytes;
+  if (cacheable && !g_big_glyphs.known(font)) {
+    uint8_t saved[kFrameBytes];
+    memcpy(saved, frame, frame_bytes);
+    if (flip_180_) u8g2_->setDisplayRotation(U8G2_R0);
+    g_big_glyphs.load(font, RasterGlyph, this);
+    if (flip_180_) u8g2_->setDisplayRotation(U8G2_R2);
+    memcpy(frame, saved, frame_bytes);
+    u8g2_->setFont(font);
+    u8g2_->setDrawColor(draw_color);
+  }
+  if (cacheable && g_big_glyphs.drawStr(font, value, frame, tiles_w, tiles_h, x, y, draw_color,
+                                        flip_180_)) {
+    return;
+  }
+  u8g2_->drawStr(x, y, value);
+}
+
+// Ascent/descent/getStrWidth of `s` in `font`, from the learned tables.
+void OledU8g2::measureText(const uint8_t* font, const char* s, int16_t& ascent,
+                           int16_t& descent, int16_t& width) {
+  if (!g_text_metrics.known(font)) {
+    u8g2_->setFont(font);
+    g_text_metrics.load(font, u8g2_->getAscent(), u8g2_->getDescent(), MeasureStr, this);
+  }
+  g_text_metrics.height(font, ascent, descent);
+  width = static_cast<int16_t>(g_text_metrics.width(font, s, MeasureStr, this));
+}
+
+uint16_t OledU8g2::MeasureStr(void* ctx, const void* font, const char* s) {
+  U8G2* u8 = static_cast<OledU8g2*>(ctx)->u8g2_;
+  u8->setFont(static_cast<const uint8_t*>(font));
+  return u8->getStrWidth(s);
+}
+
+// GlyphRasterFn: draws one glyph into the GlyphCache canvas, one buffer
+// height at a time on displays shorter than the canvas.
+int16_t OledU8g2::RasterGlyph(void* ctx, const void* font, char ch, uint8_t draw_color,
+                              uint8_t* canvas) {
+  U8G2* u8 = static_cast<OledU8g2*>(ctx)->u8g2_;
+  const int16_t band_rows = static_cast<int16_t>(u8->getBufferTileHeight() * 8);
+  const int16_t canvas_rows = GlyphCache::kCanvasPages * 8;
+  const char s[2] = {ch, '\0'};
+  int16_t advance = 0;
+  for (int16_t band = 0; band < canvas_rows; band = static_cast<int16_t>(band + band_rows)) {
+    u8->clearBuffer();
+    u8->setFont(static_cast<const uint8_t*>(font));
+    u8->setDrawColor(draw_color);
+    advance = static_cast<int16_t>(
+        u8->drawStr(GlyphCache::kOriginX, static_cast<int16_t>(GlyphCache::kOriginY - band), s));
+    const int16_t rows = (canvas_rows - band < band_rows) ? canvas_rows - band : band_rows;
+    memcpy(canvas + (band / 8) * GlyphCache::kCanvasW, u8->getBufferPtr(),
+           static_cast<size_t>(rows / 8) * GlyphCache::kCanvasW);
+  }
+  return advance;
+}
+
+void OledU8g2::noteSkippedFrame() {
+  ++stats_.skipped_frames;
+  // Nothing is sent while the content holds still; once the periodic full
+  // transfer is due, moving the epoch makes the caller send the next frame.
+  if ((millis() - last_full_ms_) >= kFullRefreshMs) ++frame_epoch_;
+}
+
+void OledU8g2::sendFrame() {
+  const uint32_t start_us = micros();
+  ++frame_epoch_;
+  uint8_t* frame = u8g2_->getBufferPtr();
+  const uint8_t tiles_w = u8g2_->getBufferTileWidth();
+  const uint8_t tiles_h = u8g2_->getBufferTileHeight();
+  const size_t frame_bytes = static_cast<size_t>(tiles_w) * tiles_h * 8;
+  if (frame_bytes > kFrameBytes) {
+    IoLock lock(*this);
     u8g2_->sendBuffer();
+  } else if (async_) {
+    portENTER_CRITICAL(&swap_mux_);
+    if (back_pending_) ++stats_.superseded;
+    memcpy(back_, frame, frame_bytes);
+    back_tiles_w_ = tiles_w;
+    back_tiles_h_ = tiles_h;
+    back_pending_ = true;
+    portEXIT_CRITICAL(&swap_mux_);
+  } else {
+    IoLock lock(*this);
+    back_pending_ = false;  // superseded by this frame
+    transferFrame(frame, tiles_w, tiles_h);
+  }
+  blocked_us_ += micros() - start_us;
+}
+
+bool OledU8g2::transferPending() {
+  if (!back_pending_) {
+    return false;
+  }
+  // Lock before the swap so a synchronous send cannot slip in between and be
+  // overwritten by this older frame.
+  IoLock lock(*this);
+  portENTER_CRITICAL(&swap_mux_);
+  const bool pending = back_pending_;
+  const uint8_t tiles_w = back_tiles_w_;
+  const uint8_t tiles_h = back_tiles_h_;
+  if (pending) {
+    uint8_t* frame = back_;
+    back_ = front_;
+    front_ = frame;
+    back_pending_ = false;
+  }
+  portEXIT_CRITICAL(&swap_mux_);
+  if (!pending || !ready_ || !u8g2_) {
+    return false;
+  }
+  if (tiles_w != u8g2_->getBufferTileWidth() || tiles_h != u8g2_->getBufferTileHeight()) {
+    return false;  // display re-initialized with another geometry since
+  }
+  transferFrame(front_, tiles_w, tiles_h);
+  return true;
+}
+
+void OledU8g2::transferFrame(const uint8_t* frame, uint8_t tiles_w, uint8_t tiles_h) {
+  const uint32_t start_us = micros();
+  const size_t frame_bytes = static_cast<size_t>(tiles_w) * tiles_h * 8;
+  const uint32_t full_cost = frame_bytes + tiles_h * kTileRunOverheadBytes;
+  TileRun runs[kMaxTileRuns];
+  uint8_t run_count = 0;
+  uint16_t changed_tiles = 0;
+  const uint32_t now_ms = millis();
+  bool partial = shadow_valid_ && (now_ms - last_full_ms_) < kFullRefreshMs &&
+                 FindChangedTileRuns(frame, shadow_, tiles_w, tiles_h, runs, kMaxTileRuns,
+                                     run_count, changed_tiles);
+  uint32_t cost = partial ? (changed_tiles * 8U + run_count * kTileRunOverheadBytes)
+                          : full_cost;
+  if (cost >= full_cost) {
+    partial = false;
+    cost = full_cost;
+  }
+  // Tiles go out straight from |frame| (not the U8g2 buffer), so the loop can
+  // draw the next frame while this one is on the bus.
+  u8x8_t* u8x8 = u8g2_->getU8x8();
+  uint8_t* tiles = const_cast<uint8_t*>(frame);
+  if (partial) {
+    for (uint8_t i = 0; i < run_count; ++i) {
+      const size_t offset = (static_cast<size_t>(runs[i].y) * tiles_w + runs[i].x) * 8;
+      u8x8_DrawTile(u8x8, runs[i].x, runs[i].y, runs[i].w, tiles + offset);
+    }
+    if (run_count == 0) {
+      ++stats_.unchanged_frames;
+    } else {
+      ++shown_seq_;
+    }
+  } else {
+    for (uint8_t ty = 0; ty < tiles_h; ++ty) {
+      u8x8_DrawTile(u8x8, 0, ty, tiles_w, tiles + static_cast<size_t>(ty) * tiles_w * 8);
+    }
+    u8x8_RefreshDisplay(u8x8);
+    ++stats_.full_frames;
+    ++shown_seq_;
+    last_full_ms_ = now_ms;
+  }
+  memcpy(shadow_, frame, frame_bytes);
+  shadow_valid_ = true;
+  ++stats_.frames;
+  stats_.bytes_last = static_cast<uint16_t>(cost);
+  stats_.bytes_total += cost;
+  stats_.transfer_us_total += micros() - start_us;
+}
+
+bool OledU8g2::copyShownFrame(uint8_t* out, uint8_t& tiles_w, uint8_t& tiles_h) {
+  if (!io_lock_ || xSemaphoreTakeRecursive(io_lock_, 0) != pdTRUE) {
+    return false;
+  }
+  const bool ok = ready_ && u8g2_ && shadow_valid_;
+  if (ok) {
+    tiles_w = u8g2_->getBufferTileWidth();
+    tiles_h = u8g2_->getBufferTileHeight();
+    memcpy(out, shadow_, static_cast<size_t>(tiles_w) * tiles_h * 8);
+  }
+  unlockIo();
+  return ok;
+}
+
+void OledU8g2::lockIo() {
+  if (io_lock_) {
+    xSemaphoreTakeRecursive(io_lock_, portMAX_DELAY);
+  }
+}
+
+void OledU8g2::unlockIo() {
+  if (io_lock_) {
+    xSemaphoreGiveRecursive(io_lock_);
   }
 }
 
@@ -591,7 +842,7 @@ void OledU8g2::drawLines(const char* line1, const char* line2,
       }
     }
   }
-  u8g2_->sendBuffer();
+  sendFrame();
 }
 
 void OledU8g2::simpleClear() {
@@ -600,9 +851,25 @@ void OledU8g2::simpleClear() {
   }
 }
 
+void OledU8g2::saveBuffer(uint8_t* out) const {
+  if (ready_) {
+    const size_t n = static_cast<size_t>(u8g2_->getBufferTileWidth()) *
+                     u8g2_->getBufferTileHeight() * 8;
+    memcpy(out, u8g2_->getBufferPtr(), n < kFrameBytes ? n : kFrameBytes);
+  }
+}
+
+void OledU8g2::restoreBuffer(const uint8_t* in) {
+  if (ready_) {
+    const size_t n = static_cast<size_t>(u8g2_->getBufferTileWidth()) *
+                     u8g2_->getBufferTileHeight() * 8;
+    memcpy(u8g2_->getBufferPtr(), in, n < kFrameBytes ? n : kFrameBytes);
+  }
+}
+
 void OledU8g2::simpleSend() {
   if (ready_) {
-    u8g2_->sendBuffer();
+    sendFrame();
   }
 }
 
@@ -647,7 +914,7 @@ void OledU8g2::drawLoadingFrame(uint8_t progress_pct, const char* title) {
   if (inner_width > 0) {
     u8g2_->drawBox(2, bar_y + 2, inner_width, (bar_height > 4) ? bar_height - 4 : bar_height);
   }
-  u8g2_->sendBuffer();
+  sendFrame();
 }
 
 void OledU8g2::drawScrollingText(const char* text, const uint8_t* font,
@@ -667,7 +934,7 @@ void OledU8g2::drawScrollingText(const char* text, const uint8_t* font,
   if (baseline < y_min) baseline = y_min;
   if (baseline > y_max) baseline = y_max;
   u8g2_->drawStr(x, baseline, text);
-  u8g2_->sendBuffer();
+  sendFrame();
 }
 
 uint16_t OledU8g2::measureText(const char* text, const uint8_t* font) {
@@ -692,7 +959,7 @@ void OledU8g2::drawCenteredText(const char* text, const uint8_t* font) {
   int16_t x = (u8g2_->getDisplayWidth() - w) / 2;
   if (x < 0) x = 0;
   u8g2_->drawStr(x, baseline, text);
-  u8g2_->sendBuffer();
+  sendFrame();
 }
 
 void OledU8g2::clearDisplay() {
@@ -700,5 +967,5 @@ void OledU8g2::clearDisplay() {
     return;
   }
   u8g2_->clearBuffer();
-  u8g2_->sendBuffer();
+  sendFrame();
 }
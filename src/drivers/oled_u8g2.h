@@ -4,6 +4,10 @@
 #include <cstddef>
 #include <string>
 
+#include "drivers/sw_i2c.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
 class OledU8g2 {
  public:
   enum class Bus {
@@ -23,6 +27,9 @@ class OledU8g2 {
   void setSleep(bool sleep_on);
   void setRotation(bool flip_180);
   void setInvert(bool on);
+  // Whole-panel flash: flips the panel's invert on top of setInvert with
+  // one SSD1306 command (0xA6/0xA7) instead of redrawing the frame.
+  void setFlash(bool on);
   uint8_t height() const { return (ready_ && u8g2_) ? u8g2_->getDisplayHeight() : 0; }
   uint8_t width() const { return (ready_ && u8g2_) ? u8g2_->getDisplayWidth() : 0; }
 
@@ -41,6 +48,10 @@ class OledU8g2 {
                  const char* line3 = nullptr, const char* line4 = nullptr);
   // Minimal passthrough helpers for boot/setup rendering.
   void simpleClear();
+  // Copies of the U8g2 buffer (at most kFrameBytes), e.g. one zone's layer
+  // of a shared panel to draw the other zone over again.
+  void saveBuffer(uint8_t* out) const;
+  void restoreBuffer(const uint8_t* in);
   void simpleSend();
   void simpleSetFontSmall();
   void simpleDrawStr(int16_t x, int16_t y, const char* s);
@@ -54,6 +65,72 @@ class OledU8g2 {
   bool sendRawCommand(uint8_t cmd);
   void setBusClockHz(uint32_t bus_hz);
   uint32_t busClockHz() const { return bus_hz_; }
+  // Bit-banged bus of a Bus::kSw display (bytes/s measured per clock).
+  const SwI2c& swBus() const { return sw_i2c_; }
+
+  // Frames go out as a diff against the last frame sent: only runs of
+  // changed 8x8 tiles are written (updateDisplayArea), or the whole buffer
+  // when that is cheaper. Byte counts are approximate bus payload (pixel
+  // bytes plus per-run addressing).
+  struct FrameStats {
+    uint32_t frames = 0;
+    uint32_t full_frames = 0;
+    uint32_t unchanged_frames = 0;
+    uint32_t bytes_total = 0;
+    uint16_t bytes_last = 0;
+    uint32_t superseded = 0;         // async frames replaced before they went out
+    uint32_t transfer_us_total = 0;  // bus time of all frames sent
+    uint32_t skipped_frames = 0;     // not sent: content already on the panel
+  };
+  const FrameStats& frameStats() const { return stats_; }
+  // A due frame was dropped by the caller because it matched the last one.
+  // Moves the epoch when the periodic full refresh is due.
+  void noteSkippedFrame();
+  // Next send pushes the whole frame (panel RAM contents no longer known).
+  void invalidateShadow() {
+    shadow_valid_ = false;
+    ++frame_epoch_;
+  }
+  // Moves on every send, (re)initialization and due full refresh: a caller
+  // that remembers the epoch after its own send knows the panel still shows
+  // that frame (and the buffer still holds it) while the epoch is unchanged.
+  uint32_t frameEpoch() const { return frame_epoch_; }
+  // U8g2 frame buffer (page-major, width() x height() / 8 bytes) and the
+  // panel's hardware invert; for host-side frame capture.
+  const uint8_t* frameBuffer() const { return u8g2_ ? u8g2_->getBufferPtr() : nullptr; }
+  bool inverted() const { return hw_invert_; }
+  bool flipped() const { return flip_180_; }
+  // Panel contents as last written (portal mirror): copies the shadow frame
+  // into `out` (kFrameBytes). False when nothing is known yet or a transfer
+  // holds the bus; never waits. `shownSeq()` moves whenever a transfer
+  // changed the panel.
+  bool copyShownFrame(uint8_t* out, uint8_t& tiles_w, uint8_t& tiles_h);
+  uint32_t shownSeq() const { return shown_seq_; }
+  static constexpr size_t kFrameBytes = 128 * 64 / 8;
+
+  // Display task hand-off. While async, a send only copies the finished
+  // U8g2 buffer into a back buffer (the newest frame wins) and returns;
+  // transferPending() runs on the display task, swaps that buffer out and
+  // streams it. A synchronous send drops any frame still waiting.
+  void setAsync(bool on) { async_ = on; }
+  bool framePending() const { return back_pending_; }
+  bool transferPending();
+  // Total time callers spent inside frame sends: the bus transfer when
+  // synchronous, only the buffer copy when async.
+  uint32_t sendBlockedUs() const { return blocked_us_; }
+
+  // Serializes bus I/O between the main loop and the display task. Hold it
+  // around recovery sequences that drive the pins or Wire directly.
+  class IoLock {
+   public:
+    explicit IoLock(OledU8g2& oled) : oled_(oled) { oled_.lockIo(); }
+    ~IoLock() { oled_.unlockIo(); }
+    IoLock(const IoLock&) = delete;
+    IoLock& operator=(const IoLock&) = delete;
+
+   private:
+    OledU8g2& oled_;
+  };
 
  private:
   Bus bus_;
@@ -62,17 +139,62 @@ class OledU8g2 {
   int8_t reset_pin_;
   bool ready_;
   uint32_t bus_hz_;
+  SwI2c sw_i2c_;
   alignas(::max_align_t) uint8_t storage_[512];
   U8G2* u8g2_;
   bool invert_on_;
+  bool flash_on_;
+  bool hw_invert_;  // invert state last commanded to the panel
+  bool flip_180_;
+  bool shadow_valid_;
+  uint8_t shadow_[kFrameBytes];  // last frame sent, U8g2 buffer layout
+  FrameStats stats_;
+  volatile uint32_t shown_seq_;
+  uint32_t frame_epoch_;
+  volatile uint32_t last_full_ms_;  // last whole-frame transfer (display task)
+  // Last auto-fit result per viewport (top/bottom zone of a 128x64 panel).
+  struct FitMemo {
+    const uint8_t* font = nullptr;
+    bool error = false;
+    uint8_t effective_h = 0;
+    uint8_t display_w = 0;
+    char shape[16] = {};
+    int16_t ascent = 0;
+    int16_t descent = 0;
+    int16_t width = 0;
+  };
+  FitMemo fit_memo_[2];
+  bool async_;
+  volatile bool back_pending_;
+  uint8_t back_tiles_w_;  // geometry of the waiting frame
+  uint8_t back_tiles_h_;
+  uint8_t* back_;   // filled by the loop
+  uint8_t* front_;  // owned by the display task while transferring
+  uint8_t frame_bufs_[2][kFrameBytes];
+  uint32_t blocked_us_;
+  SemaphoreHandle_t io_lock_;
+  portMUX_TYPE swap_mux_ = portMUX_INITIALIZER_UNLOCKED;
 
   void destroyDisplay();
+  void applyInvert();
   void createDisplay(Profile profile);
   void createDisplay64();
+  void attachSwBus();
   bool probeHwAddress();
   bool probeSwAddress();
   bool probeBusAddress();
   void ensureFonts();
+  void sendFrame();
+  void drawBigValue(const uint8_t* font, int16_t x, int16_t y, const char* value,
+                    uint8_t draw_color);
+  void measureText(const uint8_t* font, const char* s, int16_t& ascent, int16_t& descent,
+                   int16_t& width);
+  static uint16_t MeasureStr(void* ctx, const void* font, const char* s);
+  static int16_t RasterGlyph(void* ctx, const void* font, char ch, uint8_t draw_color,
+                             uint8_t* canvas);
+  void transferFrame(const uint8_t* frame, uint8_t tiles_w, uint8_t tiles_h);
+  void lockIo();
+  void unlockIo();
 };
 
 uint32_t GetSwI2cDelayUs();
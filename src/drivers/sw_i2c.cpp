@@ -0,0 +1,142 @@
+#include "drivers/sw_i2c.h"
+
+#include <Arduino.h>
+
+#if defined(ESP32)
+#include "soc/gpio_reg.h"
+#include "soc/soc.h"
+#endif
+
+namespace {
+
+// SSD1306 data hold time after SCL falls.
+constexpr uint32_t kHoldNs = 300;
+
+#if defined(ESP32)
+inline uint32_t Cycles() { return ESP.getCycleCount(); }
+inline uint32_t CpuMhz() { return getCpuFrequencyMhz(); }
+inline void PinsHigh(uint32_t mask) { REG_WRITE(GPIO_OUT_W1TS_REG, mask); }
+inline void PinsLow(uint32_t mask) { REG_WRITE(GPIO_OUT_W1TC_REG, mask); }
+inline uint32_t PinsIn() { return REG_READ(GPIO_IN_REG); }
+// Recovery code drives these pins with pinMode(), which drops the output
+// enable; the open-drain setup is then gone.
+inline bool PinsOutput(uint32_t mask) { return (REG_READ(GPIO_ENABLE_REG) & mask) == mask; }
+inline void ClaimPin(uint8_t pin) { pinMode(pin, OUTPUT_OPEN_DRAIN | PULLUP); }
+#else
+// Host builds (native_render): no bus, SDA reads high (NACK); cycles are
+// microseconds.
+inline uint32_t Cycles() { return micros(); }
+inline uint32_t CpuMhz() { return 1; }
+inline void PinsHigh(uint32_t) {}
+inline void PinsLow(uint32_t) {}
+inline uint32_t PinsIn() { return 0xFFFFFFFFu; }
+inline bool PinsOutput(uint32_t) { return true; }
+inline void ClaimPin(uint8_t) {}
+#endif
+
+}  // namespace
+
+SwI2c::SwI2c(uint8_t sda, uint8_t scl)
+    : sda_(sda), scl_(scl), sda_mask_(1UL << sda), scl_mask_(1UL << scl) {}
+
+void SwI2c::begin() {
+  PinsHigh(sda_mask_ | scl_mask_);  // released as soon as the driver attaches
+  ClaimPin(sda_);
+  ClaimPin(scl_);
+  claimed_ = true;
+  setClockHz(0);
+  edge_cycles_ = Cycles();
+}
+
+void SwI2c::setClockHz(uint32_t bus_hz) {
+  if (bus_hz > 0) bus_hz_ = bus_hz;
+  cpu_mhz_ = CpuMhz();
+  half_cycles_ = (cpu_mhz_ * 1000000UL) / (2UL * bus_hz_);
+  hold_cycles_ = (cpu_mhz_ * kHoldNs + 999U) / 1000U;
+}
+
+void SwI2c::claimIfLost() {
+  if (!claimed_ || !PinsOutput(sda_mask_ | scl_mask_)) begin();
+}
+
+void SwI2c::waitHalf() {
+  const uint32_t target = edge_cycles_ + half_cycles_;
+  uint32_t now = Cycles();
+  while (static_cast<int32_t>(now - target) < 0) now = Cycles();
+  edge_cycles_ = now;
+}
+
+void SwI2c::waitHold() const {
+  const uint32_t target = edge_cycles_ + hold_cycles_;
+  while (static_cast<int32_t>(Cycles() - target) < 0) {
+  }
+}
+
+void SwI2c::sclLow() { PinsLow(scl_mask_); }
+void SwI2c::sclRelease() { PinsHigh(scl_mask_); }
+void SwI2c::sdaLow() { PinsLow(sda_mask_); }
+void SwI2c::sdaRelease() { PinsHigh(sda_mask_); }
+bool SwI2c::sdaRead() const { return (PinsIn() & sda_mask_) != 0; }
+
+void SwI2c::start() {
+  claimIfLost();
+  sdaRelease();
+  sclRelease();
+  waitHalf();
+  sdaLow();
+  waitHalf();
+  sclLow();
+  start_cycles_ = edge_cycles_;
+  bytes_in_transfer_ = 0;
+}
+
+void SwI2c::stop() {
+  waitHold();
+  sdaLow();
+  waitHalf();
+  sclRelease();
+  waitHalf();
+  sdaRelease();
+  const uint32_t us = (edge_cycles_ - start_cycles_) / cpu_mhz_;
+  ClockStats* entry = nullptr;
+  for (uint8_t i = 0; i < clock_count_; ++i) {
+    if (clocks_[i].hz == bus_hz_) entry = &clocks_[i];
+  }
+  if (!entry && clock_count_ < kMaxClocks) {
+    entry = &clocks_[clock_count_++];
+    entry->hz = bus_hz_;
+  }
+  if (!entry) return;
+  if (entry->us > 0x80000000UL) {  // keep the ratio, drop old history
+    entry->us /= 2;
+    entry->bytes /= 2;
+  }
+  entry->us += us;
+  entry->bytes += bytes_in_transfer_;
+}
+
+bool SwI2c::writeByte(uint8_t data) {
+  for (uint8_t i = 0; i < 8; ++i) {
+    waitHold();
+    if (data & 0x80) {
+      sdaRelease();
+    } else {
+      sdaLow();
+    }
+    waitHalf();
+    sclRelease();
+    waitHalf();
+    sclLow();
+    data <<= 1;
+  }
+  // ACK clock: SDA released, sampled while SCL is high.
+  waitHold();
+  sdaRelease();
+  waitHalf();
+  sclRelease();
+  waitHalf();
+  const bool ack = !sdaRead();
+  sclLow();
+  ++bytes_in_transfer_;
+  return ack;
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <stdint.h>
+
+// Bit-banged I2C master for the OLED2 bus. SDA and SCL are claimed once as
+// open-drain outputs with the internal pull-ups on; every edge after that is
+// a single write to the GPIO set/clear registers, and bit timing spins on the
+// CPU cycle counter against the previous edge instead of pinMode/digitalWrite
+// plus delayMicroseconds (whose 1 us steps and call overhead set the bit rate
+// before). Transfers are write-only with an ACK check, no clock stretching.
+class SwI2c {
+ public:
+  static constexpr uint8_t kMaxClocks = 4;
+
+  // Bytes and bus time measured between START and STOP, per bus clock.
+  struct ClockStats {
+    uint32_t hz = 0;
+    uint32_t bytes = 0;
+    uint32_t us = 0;
+    uint32_t bytesPerSec() const {
+      return us ? static_cast<uint32_t>((static_cast<uint64_t>(bytes) * 1000000U) / us) : 0;
+    }
+  };
+
+  SwI2c(uint8_t sda, uint8_t scl);
+
+  // Claims the pins (both released high). Transfers re-claim them on their
+  // own after something else reconfigured them.
+  void begin();
+  // SCL rate; 0 keeps the current one.
+  void setClockHz(uint32_t bus_hz);
+  uint32_t clockHz() const { return bus_hz_; }
+
+  void start();
+  void stop();
+  // MSB first; true when the target ACKed.
+  bool writeByte(uint8_t data);
+
+  const ClockStats* clockStats(uint8_t& count) const {
+    count = clock_count_;
+    return clocks_;
+  }
+
+ private:
+  void claimIfLost();
+  void waitHalf();
+  void waitHold() const;
+  void sclLow();
+  void sclRelease();
+  void sdaLow();
+  void sdaRelease();
+  bool sdaRead() const;
+
+  uint8_t sda_;
+  uint8_t scl_;
+  uint32_t sda_mask_;
+  uint32_t scl_mask_;
+  bool claimed_ = false;
+  uint32_t bus_hz_ = 100000;
+  uint32_t cpu_mhz_ = 1;
+  uint32_t half_cycles_ = 0;
+  uint32_t hold_cycles_ = 0;
+  uint32_t edge_cycles_ = 0;  // cycle count at the last edge
+  uint32_t start_cycles_ = 0;
+  uint32_t bytes_in_transfer_ = 0;
+  ClockStats clocks_[kMaxClocks];
+  uint8_t clock_count_ = 0;
+};
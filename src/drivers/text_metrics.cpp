@@ -0,0 +1,104 @@
+#include "drivers/text_metrics.h"
+
+#include <string.h>
+
+namespace {
+
+constexpr char kTableChars[TextMetrics::kCharCount + 1] = "0123456789-+.";
+
+int8_t CharIndex(char ch) {
+  const char* p = strchr(kTableChars, ch);
+  return (ch != '\0' && p) ? static_cast<int8_t>(p - kTableChars) : -1;
+}
+
+}  // namespace
+
+const TextMetrics::FontEntry* TextMetrics::find(const void* font) const {
+  for (uint8_t i = 0; i < font_count_; ++i) {
+    if (fonts_[i].font == font) return &fonts_[i];
+  }
+  return nullptr;
+}
+
+void TextMetrics::load(const void* font, int8_t ascent, int8_t descent, StrWidthFn measure,
+                       void* ctx) {
+  if (find(font) || font_count_ >= kMaxFonts || !measure) return;
+  FontEntry& e = fonts_[font_count_++];
+  e.font = font;
+  e.ascent = ascent;
+  e.descent = descent;
+  // "0" has ink, so appending it always triggers U8g2's last-glyph
+  // adjustment and W(c + "0") - W("0") is exactly c's advance.
+  const int16_t zero = static_cast<int16_t>(measure(ctx, font, "0"));
+  for (uint8_t i = 0; i < kCharCount; ++i) {
+    const char one[2] = {kTableChars[i], '\0'};
+    const char pair[3] = {kTableChars[i], '0', '\0'};
+    e.last_width[i] = static_cast<int16_t>(measure(ctx, font, one));
+    e.advance[i] = static_cast<int16_t>(measure(ctx, font, pair) - zero);
+  }
+  e.uniform_digits = true;
+  for (uint8_t i = 1; i < 10; ++i) {
+    if (e.advance[i] != e.advance[0] || e.last_width[i] != e.last_width[0]) {
+      e.uniform_digits = false;
+    }
+  }
+}
+
+bool TextMetrics::height(const void* font, int16_t& ascent, int16_t& descent) const {
+  const FontEntry* e = find(font);
+  if (!e) return false;
+  ascent = e->ascent;
+  descent = e->descent;
+  return true;
+}
+
+bool TextMetrics::uniformDigits(const void* font) const {
+  const FontEntry* e = find(font);
+  return e && e->uniform_digits;
+}
+
+uint16_t TextMetrics::width(const void* font, const char* s, StrWidthFn measure, void* ctx) {
+  if (!s || s[0] == '\0') return 0;
+  if (const FontEntry* e = find(font)) {
+    int16_t w = 0;
+    const char* p = s;
+    for (; *p; ++p) {
+      const int8_t idx = CharIndex(*p);
+      if (idx < 0) break;
+      w = static_cast<int16_t>(w + (p[1] ? e->advance[idx] : e->last_width[idx]));
+    }
+    if (*p == '\0') {
+      ++arithmetic_;
+      return static_cast<uint16_t>(w);
+    }
+  }
+  const size_t len = strlen(s);
+  if (len <= kMemoChars) {
+    for (const MemoEntry& m : memo_) {
+      if (m.font == font && strcmp(m.text, s) == 0) {
+        ++memo_hits_;
+        return m.width;
+      }
+    }
+  }
+  ++measured_;
+  const uint16_t w = measure(ctx, font, s);
+  if (len <= kMemoChars) {
+    MemoEntry& m = memo_[memo_next_];
+    memo_next_ = static_cast<uint8_t>((memo_next_ + 1) % kMemoSlots);
+    m.font = font;
+    memcpy(m.text, s, len + 1);
+    m.width = w;
+  }
+  return w;
+}
+
+bool ValueShape(const char* s, char* out, size_t out_len) {
+  size_t i = 0;
+  for (; s[i]; ++i) {
+    if (i + 1 >= out_len) return false;
+    out[i] = (s[i] >= '0' && s[i] <= '9') ? '0' : s[i];
+  }
+  out[i] = '\0';
+  return true;
+}
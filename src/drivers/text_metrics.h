@@ -0,0 +1,66 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Memoized text metrics for renderMetric's auto-fit. U8g2's getStrWidth
+// walks the compressed font data for every glyph of every candidate font on
+// every frame. For the value characters (digits, signs, decimal point) each
+// font gets a table learned once through U8g2 itself, and widths become
+// arithmetic with U8g2's rule: advances of all glyphs but the last, plus the
+// last glyph's ink width. Other strings (error text) go through a small
+// font+string memo.
+
+// U8g2 getStrWidth of `s` in `font`.
+typedef uint16_t (*StrWidthFn)(void* ctx, const void* font, const char* s);
+
+class TextMetrics {
+ public:
+  static constexpr uint8_t kMaxFonts = 6;
+  static constexpr uint8_t kCharCount = 13;
+  static constexpr uint8_t kMemoSlots = 8;
+  static constexpr size_t kMemoChars = 12;
+
+  // Learns `font` (no-op when known). `ascent`/`descent` as U8g2 reports
+  // them after setFont.
+  void load(const void* font, int8_t ascent, int8_t descent, StrWidthFn measure, void* ctx);
+  bool known(const void* font) const { return find(font) != nullptr; }
+  bool height(const void* font, int16_t& ascent, int16_t& descent) const;
+  // Every digit has the same advance and ink width: equal-shape values
+  // (see ValueShape) have equal widths.
+  bool uniformDigits(const void* font) const;
+  // getStrWidth equivalent; calls `measure` only on a memo miss.
+  uint16_t width(const void* font, const char* s, StrWidthFn measure, void* ctx);
+
+  uint32_t arithmetic() const { return arithmetic_; }
+  uint32_t memoHits() const { return memo_hits_; }
+  uint32_t measured() const { return measured_; }
+
+ private:
+  struct FontEntry {
+    const void* font;
+    int8_t ascent;
+    int8_t descent;
+    bool uniform_digits;
+    int16_t advance[kCharCount];
+    int16_t last_width[kCharCount];  // getStrWidth of the glyph alone
+  };
+  struct MemoEntry {
+    const void* font;
+    char text[kMemoChars + 1];
+    uint16_t width;
+  };
+  const FontEntry* find(const void* font) const;
+
+  FontEntry fonts_[kMaxFonts] = {};
+  uint8_t font_count_ = 0;
+  MemoEntry memo_[kMemoSlots] = {};
+  uint8_t memo_next_ = 0;
+  uint32_t arithmetic_ = 0;
+  uint32_t memo_hits_ = 0;
+  uint32_t measured_ = 0;
+};
+
+// Shape of a value for the auto-fit fast path: digits folded to '0' ("851"
+// and "917" are both "000"), everything else kept. False if it does not fit.
+bool ValueShape(const char* s, char* out, size_t out_len);
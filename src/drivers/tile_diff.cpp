@@ -0,0 +1,28 @@
+#include "drivers/tile_diff.h"
+
+#include <string.h>
+
+bool FindChangedTileRuns(const uint8_t* frame, const uint8_t* shadow, uint8_t tiles_w,
+                         uint8_t tiles_h, TileRun* runs, uint8_t max_runs,
+                         uint8_t& run_count, uint16_t& changed_tiles) {
+  run_count = 0;
+  changed_tiles = 0;
+  for (uint8_t ty = 0; ty < tiles_h; ++ty) {
+    const size_t row = static_cast<size_t>(ty) * tiles_w * 8;
+    uint8_t tx = 0;
+    while (tx < tiles_w) {
+      if (memcmp(frame + row + tx * 8, shadow + row + tx * 8, 8) == 0) {
+        ++tx;
+        continue;
+      }
+      const uint8_t start = tx;
+      while (tx < tiles_w && memcmp(frame + row + tx * 8, shadow + row + tx * 8, 8) != 0) {
+        ++tx;
+      }
+      if (run_count >= max_runs) return false;
+      runs[run_count++] = TileRun{start, ty, static_cast<uint8_t>(tx - start)};
+      changed_tiles = static_cast<uint16_t>(changed_tiles + (tx - start));
+    }
+  }
+  return true;
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Tile-level change detection for U8g2 full-buffer frames (SSD1306 layout:
+// one byte per column per 8-pixel tile row, so an 8x8 tile is 8 consecutive
+// bytes). Used to push only the changed tiles with updateDisplayArea().
+
+struct TileRun {
+  uint8_t x;  // first tile column
+  uint8_t y;  // tile row
+  uint8_t w;  // tiles
+};
+
+// Collects horizontal runs of tiles that differ between `frame` and
+// `shadow`. False when more than `max_runs` runs would be needed (send the
+// whole frame instead). `changed_tiles` receives the number of differing tiles.
+bool FindChangedTileRuns(const uint8_t* frame, const uint8_t* shadow, uint8_t tiles_w,
+                         uint8_t tiles_h, TileRun* runs, uint8_t max_runs,
+                         uint8_t& run_count, uint16_t& changed_tiles);
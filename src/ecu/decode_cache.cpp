@@ -0,0 +1,72 @@
+#include "ecu/decode_cache.h"
+
+#include <string.h>
+
+namespace {
+
+constexpr uint32_t kExtdKeyBit = 0x80000000u;  // identifiers are <= 29 bits
+
+uint32_t KeyFor(uint32_t id, bool extd) { return extd ? (id | kExtdKeyBit) : id; }
+
+// Bytes past the DLC are not part of the frame; keep them out of the key.
+uint64_t PackPayload(uint8_t dlc, const uint8_t* data) {
+  uint64_t v = 0;
+  memcpy(&v, data, dlc);
+  return v;
+}
+
+uint8_t ClampDlc(uint8_t dlc) { return (dlc > 8) ? static_cast<uint8_t>(8) : dlc; }
+
+}  // namespace
+
+const DecodeCache::Entry* DecodeCache::find(uint32_t id, bool extd, uint8_t dlc,
+                                            const uint8_t* data) {
+  const uint32_t key = KeyFor(id, extd);
+  dlc = ClampDlc(dlc);
+  for (const Entry& e : entries_) {
+    if (e.valid && e.key == key) {
+      if (e.dlc == dlc && e.payload == PackPayload(dlc, data)) {
+        ++hits_;
+        return &e;
+      }
+      break;
+    }
+  }
+  ++misses_;
+  return nullptr;
+}
+
+void DecodeCache::store(uint32_t id, bool extd, uint8_t dlc, const uint8_t* data,
+                        const SignalSample* batch, uint8_t count, uint32_t reject) {
+  if (!batch || count > kMaxSignals) return;
+  Entry* e = slotFor(KeyFor(id, extd));
+  dlc = ClampDlc(dlc);
+  e->payload = PackPayload(dlc, data);
+  e->dlc = dlc;
+  e->count = count;
+  e->reject = reject;
+  memcpy(e->batch, batch, count * sizeof(SignalSample));
+  e->valid = true;
+}
+
+void DecodeCache::clear() {
+  for (Entry& e : entries_) e.valid = false;
+  next_victim_ = 0;
+  hits_ = 0;
+  misses_ = 0;
+}
+
+DecodeCache::Entry* DecodeCache::slotFor(uint32_t key) {
+  Entry* free_slot = nullptr;
+  for (Entry& e : entries_) {
+    if (e.valid && e.key == key) return &e;
+    if (!e.valid && !free_slot) free_slot = &e;
+  }
+  if (!free_slot) {
+    // More live IDs than slots: evict round-robin.
+    free_slot = &entries_[next_victim_];
+    next_victim_ = static_cast<uint8_t>((next_victim_ + 1) % kSlots);
+  }
+  free_slot->key = key;
+  return free_slot;
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "data/datastore.h"
+
+// Remembers the last payload and decoded batch per CAN ID. An idling engine
+// sends mostly byte-identical dash frames; for those the RX path replays the
+// cached batch (and its limit-reject mask) instead of re-running bit
+// extraction, scaling and range checks. The store's deadband then turns the
+// replayed write into a freshness-only refresh.
+class DecodeCache {
+ public:
+  static constexpr uint8_t kSlots = 8;       // >= dash IDs of any profile
+  static constexpr uint8_t kMaxSignals = 8;  // per message
+
+  struct Entry {
+    uint32_t key = 0;  // identifier | extended flag
+    uint64_t payload = 0;
+    uint8_t dlc = 0;
+    uint8_t count = 0;
+    bool valid = false;
+    uint32_t reject = 0;
+    SignalSample batch[kMaxSignals];
+  };
+
+  // The cached decode when `data` repeats the last payload stored for this
+  // ID, else nullptr (counted as a miss; decode and store() it).
+  const Entry* find(uint32_t id, bool extd, uint8_t dlc, const uint8_t* data);
+  void store(uint32_t id, bool extd, uint8_t dlc, const uint8_t* data,
+             const SignalSample* batch, uint8_t count, uint32_t reject);
+  void clear();
+
+  uint32_t hits() const { return hits_; }
+  uint32_t misses() const { return misses_; }
+
+ private:
+  Entry* slotFor(uint32_t key);
+
+  Entry entries_[kSlots];
+  uint8_t next_victim_ = 0;
+  uint32_t hits_ = 0;
+  uint32_t misses_ = 0;
+};
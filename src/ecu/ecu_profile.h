@@ -3,6 +3,7 @@
 #include <Arduino.h>
 #include "driver/twai.h"
 
+#include "data/signal_registry.h"
 #include "ms3_decode/ms3_decode.h"
 
 // Temporary alias until multiple ECU profiles are implemented.
@@ -79,4 +80,8 @@ class IEcuProfile {
   virtual uint32_t fixedBitrate() const = 0;
   virtual uint32_t preferredBitrate() const = 0;  // fallback: first scan bitrate or fixed
   virtual bool requiresAckPeer() const = 0;
+
+  // Called once at boot, before DataStore sizing: declare channels beyond
+  // the built-in SignalId set and/or override plausibility limits.
+  virtual void declareSignals(SignalRegistry& registry) const { (void)registry; }
 };
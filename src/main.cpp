@@ -12,6 +12,10 @@
 #include "can_link/can_autobaud.h"
 #include "can_link/twai_link.h"
 #include "data/datastore.h"
+#include "data/signal_aggregates.h"
+#include "data/signal_filter.h"
+#include "data/signal_health.h"
+#include "data/signal_history.h"
 #include "drivers/oled_u8g2.h"
 #include "ecu/ecu_manager.h"
 #include "freertos/FreeRTOS.h"
@@ -36,6 +40,14 @@ TwaiLink g_twai;
 Ms3Decoder g_decoder;
 DataStore g_datastore_can;
 DataStore g_datastore_demo;
+SignalHistory g_history_can;
+SignalAggregates g_aggregates_can;
+SignalAggregates g_aggregates_demo;
+SignalHealth g_health_can;
+SignalFilters g_filters_can;
+SignalFilters g_filters_demo;
+DerivedChannels g_derived_can;
+DerivedChannels g_derived_demo;
 uint8_t g_wire_sda_pin = Pins::kI2cSda;
 uint8_t g_wire_scl_pin = Pins::kI2cScl;
 NvsStore g_nvs;
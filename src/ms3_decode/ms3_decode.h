@@ -6,10 +6,9 @@
 #include "data/datastore.h"
 #include "ms3_decode/ms3_decode_table.h"
 
-struct Ms3SignalValue {
-  SignalId id;
-  float phys;
-};
+// Same layout as the DataStore batch type so decoded frames feed
+// DataStore::updateGroup() without a copy.
+using Ms3SignalValue = SignalSample;
 
 class Ms3Decoder {
  public:
@@ -188,8 +188,35 @@ bool NvsStore::saveEcuPersist(const EcuPersist& in) {
   return ok;
 }
 
+namespace {
+
+// Packed per-signal filter table: kind, param lo, param hi.
+constexpr size_t kFilterBlobBytes = kSignalCount * 3;
+
+void PackFilters(const SignalFilterCfg (&in)[kSignalCount],
+                 uint8_t (&blob)[kFilterBlobBytes]) {
+  for (size_t i = 0; i < kSignalCount; ++i) {
+    blob[i * 3] = static_cast<uint8_t>(in[i].kind);
+    blob[i * 3 + 1] = static_cast<uint8_t>(in[i].param & 0xFFu);
+    blob[i * 3 + 2] = static_cast<uint8_t>(in[i].param >> 8);
+  }
+}
+
+void UnpackFilters(const uint8_t (&blob)[kFilterBlobBytes],
+                   SignalFilterCfg (&out)[kSignalCount]) {
+  for (size_t i = 0; i < kSignalCount; ++i) {
+    SignalFilterCfg cfg;
+    cfg.kind = static_cast<FilterKind>(blob[i * 3]);
+    cfg.param = static_cast<uint16_t>(blob[i * 3 + 1] | (blob[i * 3 + 2] << 8));
+    out[i] = SanitizeFilterCfg(cfg);
+  }
+}
+
+}  // namespace
+
 bool NvsStore::loadUserSensors(UserSensorCfg (&out)[2], float& stoich_afr,
-                               bool& afr_show_lambda) {
+                               bool& afr_show_lambda,
+                               SignalFilterCfg (&filters)[kSignalCount]) {
   Preferences prefs;
   if (!prefs.begin(kNamespace, true)) {
     return false;
@@ -229,6 +256,13 @@ bool NvsStore::loadUserSensors(UserSensorCfg (&out)[2], float& stoich_afr,
 
     stoich_afr = prefs.getFloat(kKeyStoichAfr, stoich_afr);
     afr_show_lambda = prefs.getBool(kKeyAfrLambda, afr_show_lambda);
+    // Blobs from builds with fewer signals load as a prefix; the rest stay off.
+    uint8_t blob[kFilterBlobBytes] = {};
+    const size_t stored = prefs.getBytesLength(kKeySignalFilters);
+    if (stored > 0 && stored <= sizeof(blob) && (stored % 3) == 0 &&
+        prefs.getBytes(kKeySignalFilters, blob, stored) == stored) {
+      UnpackFilters(blob, filters);
+    }
     prefs.end();
     return true;
   }
@@ -257,14 +291,15 @@ bool NvsStore::loadUserSensors(UserSensorCfg (&out)[2], float& stoich_afr,
 
     stoich_afr = 14.7f;
     afr_show_lambda = false;
-    saveUserSensors(out, stoich_afr, afr_show_lambda);
+    saveUserSensors(out, stoich_afr, afr_show_lambda, filters);
     return true;
   }
   return false;
 }
 
 bool NvsStore::saveUserSensors(const UserSensorCfg (&in)[2], float stoich_afr,
-                               bool afr_show_lambda) {
+                               bool afr_show_lambda,
+                               const SignalFilterCfg (&filters)[kSignalCount]) {
   Preferences prefs;
   if (!prefs.begin(kNamespace, false)) {
     return false;
@@ -289,6 +324,40 @@ bool NvsStore::saveUserSensors(const UserSensorCfg (&in)[2], float stoich_afr,
   ok &= PutStringChecked(prefs, kKeyUs1UnitImperial, in[1].unit_imperial);
   ok &= PutFloatChecked(prefs, kKeyStoichAfr, stoich_afr);
   ok &= PutBoolChecked(prefs, kKeyAfrLambda, afr_show_lambda);
+  uint8_t blob[kFilterBlobBytes];
+  PackFilters(filters, blob);
+  ok &= prefs.putBytes(kKeySignalFilters, blob, sizeof(blob)) == sizeof(blob);
+  prefs.end();
+  return ok;
+}
+
+bool NvsStore::loadDerivedChannels(DerivedChannelCfg (&out)[kDerivedChannelCount]) {
+  static const char* const kKeys[kDerivedChannelCount] = {kKeyDerived0, kKeyDerived1,
+                                                          kKeyDerived2};
+  Preferences prefs;
+  if (!prefs.begin(kNamespace, true)) {
+    return false;
+  }
+  for (uint8_t i = 0; i < kDerivedChannelCount; ++i) {
+    if (!prefs.isKey(kKeys[i])) continue;
+    String expr = prefs.getString(kKeys[i], "");
+    strlcpy(out[i].expr, expr.c_str(), sizeof(out[i].expr));
+  }
+  prefs.end();
+  return true;
+}
+
+bool NvsStore::saveDerivedChannels(const DerivedChannelCfg (&in)[kDerivedChannelCount]) {
+  static const char* const kKeys[kDerivedChannelCount] = {kKeyDerived0, kKeyDerived1,
+                                                          kKeyDerived2};
+  Preferences prefs;
+  if (!prefs.begin(kNamespace, false)) {
+    return false;
+  }
+  bool ok = true;
+  for (uint8_t i = 0; i < kDerivedChannelCount; ++i) {
+    ok &= PutStringChecked(prefs, kKeys[i], in[i].expr);
+  }
   prefs.end();
   return ok;
 }
@@ -50,13 +50,13 @@ struct UiPersist {
   bool has_page0 = false;
   bool has_page1 = false;
   bool has_focus = false;
-  uint32_t page_units_mask = 0;
+  PageMask page_units_mask;
   bool has_page_units = false;
   bool has_zone_pages = false;
   bool has_boot_pages = false;
-  uint32_t page_alert_max_mask = 0;
-  uint32_t page_alert_min_mask = 0;
-  uint32_t page_hidden_mask = 0;
+  PageMask page_alert_max_mask;
+  PageMask page_alert_min_mask;
+  PageMask page_hidden_mask;
   bool has_alert_masks = false;
   bool has_display_topology = false;
   bool has_page_hidden = false;
@@ -89,9 +89,14 @@ class NvsStore {
   bool loadBootTexts(String& brand, String& h1, String& h2);
   bool saveBootTexts(const String& brand, const String& h1, const String& h2);
   bool loadUserSensors(UserSensorCfg (&out)[2], float& stoich_afr,
-                       bool& afr_show_lambda);
+                       bool& afr_show_lambda,
+                       SignalFilterCfg (&filters)[kSignalCount]);
   bool saveUserSensors(const UserSensorCfg (&in)[2], float stoich_afr,
-                       bool afr_show_lambda);
+                       bool afr_show_lambda,
+                       const SignalFilterCfg (&filters)[kSignalCount]);
+  // Missing keys leave `out` untouched (defaults); empty text = channel off.
+  bool loadDerivedChannels(DerivedChannelCfg (&out)[kDerivedChannelCount]);
+  bool saveDerivedChannels(const DerivedChannelCfg (&in)[kDerivedChannelCount]);
   bool factoryResetClearAll();
   bool loadWifiApPass(char* out, size_t out_len);
   bool saveWifiApPass(const char* pass);
@@ -136,6 +141,11 @@ class NvsStore {
   static constexpr const char* kKeyUiPageUnits32 = "ui_pu32";
   static constexpr const char* kKeyUiHidden = "ui_hid";
   static constexpr const char* kKeyUiHidden32 = "ui_hid32";
+  // Prefixes for page-mask words >= 1 (key = prefix + word index).
+  static constexpr const char* kKeyUiPageUnitsW = "ui_puw";
+  static constexpr const char* kKeyUiAlertMaxW = "ui_amw";
+  static constexpr const char* kKeyUiAlertMinW = "ui_alw";
+  static constexpr const char* kKeyUiHiddenW = "ui_hidw";
   static constexpr const char* kKeyUiDisplayTopo = "ui_dt";
   static constexpr const char* kKeyUiDemo = "ui_demo";
   static constexpr const char* kKeyUiEcu = "ui_ecu";
@@ -163,6 +173,10 @@ class NvsStore {
   static constexpr const char* kKeyUs1UnitImperial = "us1_ui";
   static constexpr const char* kKeyStoichAfr = "stoich_afr";
   static constexpr const char* kKeyAfrLambda = "afr_lambda";
+  static constexpr const char* kKeySignalFilters = "sig_flt";
+  static constexpr const char* kKeyDerived0 = "drv0";
+  static constexpr const char* kKeyDerived1 = "drv1";
+  static constexpr const char* kKeyDerived2 = "drv2";
  static constexpr const char* kKeyWifiApPass = "wifi_ap_pw";
   static constexpr const char* kDbcSha256 =
       "791e994238cf0e79f6a100e9550e32f3b3399c8abf8b4ff22a36e90ffd6dc693";
@@ -2,6 +2,20 @@
 
 #include <Preferences.h>
 
+namespace {
+
+// Word 0 of each page mask lives in the legacy *32 keys; higher words use
+// "<prefix><w>" so older firmware keeps reading the first 32 pages.
+void LoadMaskHighWords(Preferences& prefs, const char* prefix, PageMask& mask) {
+  for (uint8_t w = 1; w < PageMask::kWords; ++w) {
+    char key[16];
+    snprintf(key, sizeof(key), "%s%u", prefix, static_cast<unsigned>(w));
+    mask.setWord(w, prefs.getUInt(key, 0));
+  }
+}
+
+}  // namespace
+
 bool NvsStore::loadUiPersist(UiPersist& out) {
   Preferences prefs;
   if (!prefs.begin(kNamespace, true)) {
@@ -23,22 +37,34 @@ bool NvsStore::loadUiPersist(UiPersist& out) {
   out.units1 = prefs.getBool(kKeyUiUnits1, false);
   out.flip0 = prefs.getBool(kKeyUiFlip0, false);
   out.flip1 = prefs.getBool(kKeyUiFlip1, false);
+  out.page_units_mask.clear();
+  out.page_alert_max_mask.clear();
+  out.page_alert_min_mask.clear();
+  out.page_hidden_mask.clear();
   if (prefs.isKey(kKeyUiPageUnits32)) {
-    out.page_units_mask = prefs.getUInt(kKeyUiPageUnits32, 0);
+    out.page_units_mask.setWord(0, prefs.getUInt(kKeyUiPageUnits32, 0));
+    LoadMaskHighWords(prefs, kKeyUiPageUnitsW, out.page_units_mask);
   } else {
-    out.page_units_mask = static_cast<uint32_t>(prefs.getUShort(kKeyUiPageUnits, 0));
+    out.page_units_mask.setWord(
+        0, static_cast<uint32_t>(prefs.getUShort(kKeyUiPageUnits, 0)));
   }
   if (prefs.isKey("ui_am32") || prefs.isKey("ui_al32")) {
-    out.page_alert_max_mask = prefs.getUInt("ui_am32", 0);
-    out.page_alert_min_mask = prefs.getUInt("ui_al32", 0);
+    out.page_alert_max_mask.setWord(0, prefs.getUInt("ui_am32", 0));
+    out.page_alert_min_mask.setWord(0, prefs.getUInt("ui_al32", 0));
+    LoadMaskHighWords(prefs, kKeyUiAlertMaxW, out.page_alert_max_mask);
+    LoadMaskHighWords(prefs, kKeyUiAlertMinW, out.page_alert_min_mask);
   } else {
-    out.page_alert_max_mask = static_cast<uint32_t>(prefs.getUShort("ui_am", 0));
-    out.page_alert_min_mask = static_cast<uint32_t>(prefs.getUShort("ui_al", 0));
+    out.page_alert_max_mask.setWord(
+        0, static_cast<uint32_t>(prefs.getUShort("ui_am", 0)));
+    out.page_alert_min_mask.setWord(
+        0, static_cast<uint32_t>(prefs.getUShort("ui_al", 0)));
   }
   if (prefs.isKey(kKeyUiHidden32)) {
-    out.page_hidden_mask = prefs.getUInt(kKeyUiHidden32, 0);
+    out.page_hidden_mask.setWord(0, prefs.getUInt(kKeyUiHidden32, 0));
+    LoadMaskHighWords(prefs, kKeyUiHiddenW, out.page_hidden_mask);
   } else {
-    out.page_hidden_mask = static_cast<uint32_t>(prefs.getUShort(kKeyUiHidden, 0));
+    out.page_hidden_mask.setWord(
+        0, static_cast<uint32_t>(prefs.getUShort(kKeyUiHidden, 0)));
   }
   out.demo_mode = prefs.getBool(kKeyUiDemo, false);
   String ecu = prefs.getString(kKeyUiEcu, "MS3");
@@ -98,18 +124,29 @@ bool NvsStore::saveUiPersist(const UiPersist& in) {
   ok &= PutBoolChecked(prefs, kKeyUiUnits1, false);
   ok &= PutBoolChecked(prefs, kKeyUiFlip0, in.flip0);
   ok &= PutBoolChecked(prefs, kKeyUiFlip1, in.flip1);
-  ok &= PutUIntChecked(prefs, "ui_pu32", in.page_units_mask);
-  ok &= PutUIntChecked(prefs, "ui_am32", in.page_alert_max_mask);
-  ok &= PutUIntChecked(prefs, "ui_al32", in.page_alert_min_mask);
-  ok &= PutUIntChecked(prefs, "ui_hid32", in.page_hidden_mask);
+  ok &= PutUIntChecked(prefs, "ui_pu32", in.page_units_mask.word(0));
+  ok &= PutUIntChecked(prefs, "ui_am32", in.page_alert_max_mask.word(0));
+  ok &= PutUIntChecked(prefs, "ui_al32", in.page_alert_min_mask.word(0));
+  ok &= PutUIntChecked(prefs, "ui_hid32", in.page_hidden_mask.word(0));
+  for (uint8_t w = 1; w < PageMask::kWords; ++w) {
+    char key[16];
+    snprintf(key, sizeof(key), "%s%u", kKeyUiPageUnitsW, static_cast<unsigned>(w));
+    ok &= PutUIntChecked(prefs, key, in.page_units_mask.word(w));
+    snprintf(key, sizeof(key), "%s%u", kKeyUiAlertMaxW, static_cast<unsigned>(w));
+    ok &= PutUIntChecked(prefs, key, in.page_alert_max_mask.word(w));
+    snprintf(key, sizeof(key), "%s%u", kKeyUiAlertMinW, static_cast<unsigned>(w));
+    ok &= PutUIntChecked(prefs, key, in.page_alert_min_mask.word(w));
+    snprintf(key, sizeof(key), "%s%u", kKeyUiHiddenW, static_cast<unsigned>(w));
+    ok &= PutUIntChecked(prefs, key, in.page_hidden_mask.word(w));
+  }
   ok &= PutUShortChecked(prefs, kKeyUiPageUnits,
-                         static_cast<uint16_t>(in.page_units_mask & 0xFFFFu));
+                         static_cast<uint16_t>(in.page_units_mask.word(0) & 0xFFFFu));
   ok &= PutUShortChecked(prefs, "ui_am",
-                         static_cast<uint16_t>(in.page_alert_max_mask & 0xFFFFu));
+                         static_cast<uint16_t>(in.page_alert_max_mask.word(0) & 0xFFFFu));
   ok &= PutUShortChecked(prefs, "ui_al",
-                         static_cast<uint16_t>(in.page_alert_min_mask & 0xFFFFu));
+                         static_cast<uint16_t>(in.page_alert_min_mask.word(0) & 0xFFFFu));
   ok &= PutUShortChecked(prefs, kKeyUiHidden,
-                         static_cast<uint16_t>(in.page_hidden_mask & 0xFFFFu));
+                         static_cast<uint16_t>(in.page_hidden_mask.word(0) & 0xFFFFu));
   ok &= PutBoolChecked(prefs, kKeyUiDemo, in.demo_mode);
   ok &= PutStringChecked(prefs, kKeyUiEcu, in.ecu_type);
   prefs.end();
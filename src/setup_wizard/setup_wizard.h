@@ -61,11 +61,6 @@ class SetupWizard {
     uint8_t count = 0;
   };
 
-  struct SampleBuf {
-    uint32_t ts = 0;
-    float val = 0.0f;
-  };
-
   void changePhase(Phase p, uint32_t now_ms);
   void drainCan(AppState& state, uint32_t now_ms);
   void recordInterval(uint8_t idx, uint32_t ts_ms);
@@ -80,12 +75,10 @@ class SetupWizard {
   float computeSigma() const;
   float computeMean() const;
 
-  void resetRunBuffers();
+  void resetRunBuffers(uint32_t now_ms);
   void handleRun(uint32_t now_ms);
-  void pushSample(SampleBuf* buf, uint8_t capacity, uint8_t& head,
-                  uint8_t& count, uint32_t ts, float val);
-  bool computeDelta(const SampleBuf* buf, uint8_t count, uint32_t now_ms,
-                    float& delta, uint32_t window_ms) const;
+  bool computeDelta(SignalId id, uint32_t now_ms, float& delta,
+                    uint32_t window_ms) const;
   void recordDebug(const twai_message_t& msg, uint32_t now_ms);
 
   void renderFocused(const AppState& state, OledU8g2& disp, uint32_t now_ms);
@@ -129,13 +122,8 @@ class SetupWizard {
   float baro_sum_;
   uint16_t baro_count_;
 
-  // Run blip buffers
-  SampleBuf rpm_buf_[24];
-  SampleBuf map_buf_[24];
-  uint8_t rpm_count_;
-  uint8_t map_count_run_;
-  uint8_t rpm_head_;
-  uint8_t map_head_run_;
+  // Run blip window: RPM/MAP samples come from the store's history.
+  uint32_t run_start_ms_;
 
   // Validation live counters
   bool validate_active_ = false;
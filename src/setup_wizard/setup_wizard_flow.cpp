@@ -9,6 +9,7 @@
 
 #include "app/app_globals.h"
 #include "config/logging.h"
+#include "data/signal_history.h"
 #include "ecu/ecu_manager.h"
 
 extern EcuManager g_ecu_mgr;
@@ -65,15 +66,10 @@ SetupWizard::SetupWizard(TwaiLink& link, DataStore& store, NvsStore& nvs)
       baro_avg_start_ms_(0),
       baro_sum_(0.0f),
       baro_count_(0),
-      rpm_count_(0),
-      map_count_run_(0),
-      rpm_head_(0),
-      map_head_run_(0) {
+      run_start_ms_(0) {
   memset(stale_ms_, 0, sizeof(stale_ms_));
   memset(intervals_, 0, sizeof(intervals_));
   memset(map_samples_, 0, sizeof(map_samples_));
-  memset(rpm_buf_, 0, sizeof(rpm_buf_));
-  memset(map_buf_, 0, sizeof(map_buf_));
 }
 
 bool SetupWizard::isActive() const { return phase_ != Phase::kInactive; }
@@ -94,8 +90,7 @@ void SetupWizard::begin(uint8_t focus_screen, AppState& state) {
   baro_avg_start_ms_ = 0;
   baro_sum_ = 0.0f;
   baro_count_ = 0;
-  rpm_count_ = map_count_run_ = 0;
-  rpm_head_ = map_head_run_ = 0;
+  run_start_ms_ = 0;
   blip_detected_ = false;
   scan_rate_idx_ = 0;
   locked_rate_ = 0;
@@ -239,7 +234,7 @@ void SetupWizard::changePhase(Phase p, uint32_t now_ms) {
   if (p == Phase::kKoeoBaro) {
     resetBaroBuffers();
   } else if (p == Phase::kRunCapture) {
-    resetRunBuffers();
+    resetRunBuffers(now_ms);
     blip_detected_ = false;
   }
   LOGI("[WIZ] phase -> %u\r\n", static_cast<unsigned>(p));
@@ -390,43 +385,29 @@ void SetupWizard::handleBaro(uint32_t now_ms, AppState& state) {
   }
 }
 
-void SetupWizard::resetRunBuffers() {
-  memset(rpm_buf_, 0, sizeof(rpm_buf_));
-  memset(map_buf_, 0, sizeof(map_buf_));
-  rpm_count_ = map_count_run_ = 0;
-  rpm_head_ = map_head_run_ = 0;
-}
-
-void SetupWizard::pushSample(SampleBuf* buf, uint8_t capacity, uint8_t& head,
-                             uint8_t& count, uint32_t ts, float val) {
-  buf[head].ts = ts;
-  buf[head].val = val;
-  head = (head + 1) % capacity;
-  if (count < capacity) {
-    ++count;
-  }
-}
+void SetupWizard::resetRunBuffers(uint32_t now_ms) { run_start_ms_ = now_ms; }
 
-bool SetupWizard::computeDelta(const SampleBuf* buf, uint8_t count,
-                               uint32_t now_ms, float& delta,
+bool SetupWizard::computeDelta(SignalId id, uint32_t now_ms, float& delta,
                                uint32_t window_ms) const {
-  if (count == 0) {
-    delta = 0.0f;
+  delta = 0.0f;
+  HistoryView view;
+  if (!store_.readHistory(id, view)) {
     return false;
   }
   float min_v = 1e9f;
   float max_v = -1e9f;
   bool any = false;
-  for (uint8_t i = 0; i < count; ++i) {
-    const uint32_t age = now_ms - buf[i].ts;
-    if (age <= window_ms) {
-      if (buf[i].val < min_v) min_v = buf[i].val;
-      if (buf[i].val > max_v) max_v = buf[i].val;
-      any = true;
+  for (const HistorySample& s : view) {
+    // Newest first: stop at the window edge or at samples from before the run.
+    if ((now_ms - s.ts_ms) > window_ms ||
+        static_cast<int32_t>(s.ts_ms - run_start_ms_) < 0) {
+      break;
     }
+    if (s.value < min_v) min_v = s.value;
+    if (s.value > max_v) max_v = s.value;
+    any = true;
   }
   if (!any) {
-    delta = 0.0f;
     return false;
   }
   delta = max_v - min_v;
@@ -452,14 +433,10 @@ void SetupWizard::handleRun(uint32_t now_ms) {
   if (last_rpm_ms_ == 0 || last_map_ms_ == 0) {
     return;
   }
-  pushSample(rpm_buf_, 24, rpm_head_, rpm_count_, last_rpm_ms_, last_rpm_);
-  pushSample(map_buf_, 24, map_head_run_, map_count_run_, last_map_ms_,
-             last_map_kpa_);
-
   float d_rpm = 0.0f;
   float d_map = 0.0f;
-  const bool rpm_ok = computeDelta(rpm_buf_, rpm_count_, now_ms, d_rpm, 1200);
-  const bool map_ok = computeDelta(map_buf_, map_count_run_, now_ms, d_map, 1200);
+  const bool rpm_ok = computeDelta(SignalId::kRpm, now_ms, d_rpm, 1200);
+  const bool map_ok = computeDelta(SignalId::kMap, now_ms, d_map, 1200);
   if (rpm_ok && map_ok && d_rpm >= 300.0f && d_map >= 1.0f) {
     blip_detected_ = true;
     changePhase(Phase::kRunValidate, now_ms);
@@ -47,7 +47,9 @@ void enterEditMode(AppState& state, uint8_t screen, const DataStore& store,
              !isnan(state.thresholds[page_idx].min)) {
     canon_val = state.thresholds[page_idx].min;
   } else {
-    PageCanonicalValue(pid, state, cfg, store, now_ms, canon_val);
+    SignalSnapshot snap;
+    store.snapshot(kAllSignalsMask, snap, now_ms);
+    PageCanonicalValue(pid, state, cfg, snap, now_ms, canon_val);
   }
   if (isnan(canon_val)) canon_val = 0.0f;
   float disp = CanonToDisplay(meta->kind, canon_val, cfg);
@@ -47,10 +47,6 @@ void formatInt(char* buf, size_t len, uint32_t v) {
   snprintf(buf, len, "%lu", static_cast<unsigned long>(v));
 }
 
-void formatFloat1(char* buf, size_t len, float v) {
-  snprintf(buf, len, "%.1f", static_cast<double>(v));
-}
-
 static bool UseLastGood(const AppState& state, SignalId id, uint32_t now_ms,
                         uint32_t window_ms, float& out) {
   const size_t idx = static_cast<size_t>(id);
@@ -75,9 +71,9 @@ static void UpdateLastGood(const AppState& state, SignalId id, float value,
   state.last_good[idx].has_value = true;
 }
 
-bool fetch(const DataStore& store, SignalId id, uint32_t now_ms, float& out,
+bool fetch(const SignalSnapshot& snap, SignalId id, float& out,
            bool* invalid = nullptr, bool* stale = nullptr) {
-  const SignalRead r = store.get(id, now_ms);
+  const SignalRead r = snap.get(id);
   const bool inv = (r.flags & kFlagInvalid) != 0;
   const bool st = (r.flags & kFlagStale) != 0;
   if (invalid) *invalid = inv;
@@ -88,615 +84,200 @@ bool fetch(const DataStore& store, SignalId id, uint32_t now_ms, float& out,
   return true;
 }
 
-PageRenderData renderOilP(const AppState& state, const ScreenSettings& cfg,
-                          const DataStore& store, uint32_t now_ms) {
-  PageRenderData d{};
-  const UserSensorCfg cfg_us = state.user_sensor[0];
-  const char* label = cfg_us.label[0] ? cfg_us.label : defaultLabel(cfg_us.preset);
-  d.label = label;
-  const SignalId src = sourceToSignal(cfg_us.source);
-  float decoded = 0.0f;
-  bool invalid = false;
-  bool stale = false;
-  if (fetch(store, src, now_ms, decoded, &invalid, &stale)) {
-    UpdateLastGood(state, src, decoded, now_ms);
-    float canon = 0.0f;
-    if (computeCanonical(cfg_us, decoded, canon)) {
-      float disp = 0.0f;
-      const char* unit = "";
-      formatDisplay(cfg_us, cfg.imperial_units, canon, disp, unit);
-      formatFloat1(d.big, sizeof(d.big), disp);
-      d.unit = unit;
-      d.valid = true;
-      d.canon_value = canon;
-      d.has_canon = true;
-    }
-  } else if (invalid) {
-    MarkInvalid(d);
-  } else if (stale) {
-    float cached = 0.0f;
-    if (UseLastGood(state, src, now_ms, 2000, cached)) {
-      float canon = 0.0f;
-      if (computeCanonical(cfg_us, cached, canon)) {
-        float disp = 0.0f;
-        const char* unit = "";
-        formatDisplay(cfg_us, cfg.imperial_units, canon, disp, unit);
-        formatFloat1(d.big, sizeof(d.big), disp);
-        d.unit = unit;
-        d.valid = true;
-        d.canon_value = canon;
-        d.has_canon = true;
-        strlcpy(d.suffix, "!", sizeof(d.suffix));
-      }
-    } else {
-      MarkStale(d);
-    }
-  } else if (CanLinkLive(state, now_ms)) {
-    MarkInvalid(d);
+void formatDecimals(char* buf, size_t len, float v, uint8_t decimals) {
+  if (decimals == 0) {
+    formatInt(buf, len, static_cast<uint32_t>(v));
+  } else {
+    snprintf(buf, len, "%.*f", static_cast<int>(decimals), static_cast<double>(v));
   }
-  return d;
 }
 
-PageRenderData renderOilT(const AppState& state, const ScreenSettings& cfg,
-                          const DataStore& store, uint32_t now_ms) {
-  PageRenderData d{};
-  const UserSensorCfg cfg_us = state.user_sensor[1];
-  const char* label = cfg_us.label[0] ? cfg_us.label : defaultLabel(cfg_us.preset);
-  d.label = label;
-  const SignalId src = sourceToSignal(cfg_us.source);
-  float decoded = 0.0f;
-  bool invalid = false;
-  bool stale = false;
-  if (fetch(store, src, now_ms, decoded, &invalid, &stale)) {
-    UpdateLastGood(state, src, decoded, now_ms);
-    float canon = 0.0f;
-    if (computeCanonical(cfg_us, decoded, canon)) {
-      float disp = 0.0f;
-      const char* unit = "";
-      formatDisplay(cfg_us, cfg.imperial_units, canon, disp, unit);
-      formatFloat1(d.big, sizeof(d.big), disp);
-      d.unit = unit;
-      d.valid = true;
-      d.canon_value = canon;
-      d.has_canon = true;
-    }
-  } else if (invalid) {
-    MarkInvalid(d);
-  } else if (stale) {
-    float cached = 0.0f;
-    if (UseLastGood(state, src, now_ms, 2000, cached)) {
-      float canon = 0.0f;
-      if (computeCanonical(cfg_us, cached, canon)) {
-        float disp = 0.0f;
-        const char* unit = "";
-        formatDisplay(cfg_us, cfg.imperial_units, canon, disp, unit);
-        formatFloat1(d.big, sizeof(d.big), disp);
-        d.unit = unit;
-        d.valid = true;
-        d.canon_value = canon;
-        d.has_canon = true;
-        strlcpy(d.suffix, "!", sizeof(d.suffix));
-      }
-    } else {
-      MarkStale(d);
-    }
-  } else if (CanLinkLive(state, now_ms)) {
-    MarkInvalid(d);
-  }
-  return d;
+const char* unitFor(const PageMeta& m, const ScreenSettings& cfg) {
+  return cfg.imperial_units ? m.unit_imperial : m.unit;
 }
-PageRenderData renderBoost(const AppState& state, const DataStore& store,
-                            const ScreenSettings& cfg, uint32_t now_ms) {
-  PageRenderData d{};
-  d.label = "BOOST";
-  bool inv_map = false;
-  bool stale_map = false;
-  float map_kpa = 0.0f;
-  if (!fetch(store, SignalId::kMap, now_ms, map_kpa, &inv_map, &stale_map)) {
-    if (inv_map) {
-      MarkInvalid(d);
-    } else if (stale_map) {
-      float cached = 0.0f;
-      if (UseLastGood(state, SignalId::kMap, now_ms, 2000, cached)) {
-        map_kpa = cached;
-      } else {
-        MarkStale(d);
-        return d;
-      }
-    }
-  }
-  UpdateLastGood(state, SignalId::kMap, map_kpa, now_ms);
-  const bool baro_ok = state.baro_acquired;
-  const float baro_ref = baro_ok ? state.baro_kpa : 100.0f;
-  const float boost_kpa = map_kpa - baro_ref;
-  const float boost_psi = boost_kpa * kKpaToPsi;
-  const float val = cfg.imperial_units ? boost_psi : boost_kpa;
-  const char* unit = cfg.imperial_units ? "psi" : "kPa";
-  formatFloat1(d.big, sizeof(d.big), val);
-  d.unit = unit;
-  if (stale_map) {
-    strlcpy(d.suffix, "!", sizeof(d.suffix));
-  }
-  if (!baro_ok) {
-    strlcpy(d.suffix, "(est)", sizeof(d.suffix));
+
+const UserSensorCfg* userSensorFor(const PageMeta& m, const AppState& state) {
+  switch (m.render) {
+    case PageRender::kUserSensor0:
+      return &state.user_sensor[0];
+    case PageRender::kUserSensor1:
+      return &state.user_sensor[1];
+    default:
+      return nullptr;
   }
-  d.valid = true;
-  d.canon_value = boost_kpa;
-  d.has_canon = baro_ok;
-  return d;
 }
 
-
-PageRenderData renderMap(const AppState& state, const DataStore& store,
-                         const ScreenSettings& cfg, uint32_t now_ms) {
-  PageRenderData d{};
-  d.label = "MAP";
-#ifdef DEBUG_STALE_OLED2
-  static uint32_t last_map_dbg_ms = 0;
-  if ((now_ms - last_map_dbg_ms) >= 1000U) {
-    const SignalRead dbg = store.get(SignalId::kMap, now_ms);
-    LOGV("[MAPDBG] t=%lu age=%lu flags=0x%02X valid=%d val=%.3f\n",
-         static_cast<unsigned long>(now_ms),
-         static_cast<unsigned long>(dbg.age_ms), dbg.flags, dbg.valid,
-         static_cast<double>(dbg.value));
-    (void)dbg;
-    last_map_dbg_ms = now_ms;
-  }
-#endif
-  bool invalid = false;
-  bool stale = false;
-  float map_kpa = 0.0f;
-  if (!fetch(store, SignalId::kMap, now_ms, map_kpa, &invalid, &stale)) {
-    if (invalid) {
-      MarkInvalid(d);
-    } else if (stale) {
-      float cached = 0.0f;
-      if (UseLastGood(state, SignalId::kMap, now_ms, 2000, cached)) {
-        const float map_psi = cached * kKpaToPsi;
-        const float val = cfg.imperial_units ? map_psi : cached;
-        const char* unit = cfg.imperial_units ? "psi" : "kPa";
-        formatInt(d.big, sizeof(d.big),
-                  static_cast<uint32_t>(val + 0.5f));  // rounded integer
-        d.unit = unit;
-        d.valid = true;
-        d.canon_value = cached;
-        d.has_canon = true;
-        strlcpy(d.suffix, "!", sizeof(d.suffix));
-      } else {
-        MarkStale(d);
-#ifdef DEBUG_STALE_OLED2
-        const SignalRead r = store.get(SignalId::kMap, now_ms);
-        LOGV("[STALE] MAP render stale: t=%lu age=%lu flags=0x%02X val=%.3f\n",
-             static_cast<unsigned long>(now_ms),
-             static_cast<unsigned long>(r.age_ms), r.flags,
-             static_cast<double>(r.value));
-        (void)r;
-#endif
-      }
-    }
-    return d;
-  }
-  UpdateLastGood(state, SignalId::kMap, map_kpa, now_ms);
-  const float map_psi = map_kpa * kKpaToPsi;
-  const float val = cfg.imperial_units ? map_psi : map_kpa;
-  const char* unit = cfg.imperial_units ? "psi" : "kPa";
-  formatInt(d.big, sizeof(d.big),
-            static_cast<uint32_t>(val + 0.5f));  // rounded integer
-  d.unit = unit;
+void setValue(PageRenderData& d, float canon) {
   d.valid = true;
-  d.canon_value = map_kpa;
+  d.canon_value = canon;
   d.has_canon = true;
-  return d;
-}
-
-PageRenderData renderRpm(const AppState& state, const DataStore& store, uint32_t now_ms) {
-  PageRenderData d{};
-  d.label = "RPM";
-  bool invalid = false;
-  bool stale = false;
-  float v = 0.0f;
-  if (fetch(store, SignalId::kRpm, now_ms, v, &invalid, &stale)) {
-    formatInt(d.big, sizeof(d.big), static_cast<uint32_t>(v));
-    d.unit = "rpm";
-    d.valid = true;
-    d.canon_value = v;
-    d.has_canon = true;
-  } else if (invalid) {
-    MarkInvalid(d);
-  } else if (stale) {
-    MarkStale(d);
-  } else if (CanLinkLive(state, now_ms)) {
-    MarkInvalid(d);
-  }
-  return d;
-}
-
-PageRenderData renderClt(const AppState& state, const ScreenSettings& cfg,
-                         const DataStore& store, uint32_t now_ms) {
-  PageRenderData d{};
-  d.label = "CLT";
-  bool invalid = false;
-  bool stale = false;
-  float f = 0.0f;
-  if (fetch(store, SignalId::kClt, now_ms, f, &invalid, &stale)) {
-    float disp = cfg.imperial_units ? f : f_to_c(f);
-    formatInt(d.big, sizeof(d.big), static_cast<uint32_t>(disp));
-    d.unit = cfg.imperial_units ? "F" : "C";
-    d.valid = true;
-    d.canon_value = f;
-    d.has_canon = true;
-  } else if (invalid) {
-    MarkInvalid(d);
-  } else if (stale) {
-    MarkStale(d);
-  } else if (CanLinkLive(state, now_ms)) {
-    MarkInvalid(d);
-  }
-  return d;
-}
-
-PageRenderData renderMat(const AppState& state, const ScreenSettings& cfg,
-                         const DataStore& store, uint32_t now_ms) {
-  PageRenderData d{};
-  d.label = "IAT";
-  bool invalid = false;
-  bool stale = false;
-  float f = 0.0f;
-  if (fetch(store, SignalId::kMat, now_ms, f, &invalid, &stale)) {
-    float disp = cfg.imperial_units ? f : f_to_c(f);
-    formatInt(d.big, sizeof(d.big), static_cast<uint32_t>(disp));
-    d.unit = cfg.imperial_units ? "F" : "C";
-    d.valid = true;
-    d.canon_value = f;
-    d.has_canon = true;
-  } else if (invalid) {
-    MarkInvalid(d);
-  } else if (stale) {
-    MarkStale(d);
-  } else if (CanLinkLive(state, now_ms)) {
-    MarkInvalid(d);
-  }
-  return d;
-}
-
-PageRenderData renderBatt(const AppState& state, const DataStore& store, uint32_t now_ms) {
-  PageRenderData d{};
-  d.label = "BATT";
-  bool invalid = false;
-  bool stale = false;
-  float v = 0.0f;
-  if (fetch(store, SignalId::kBatt, now_ms, v, &invalid, &stale)) {
-    formatFloat1(d.big, sizeof(d.big), v);
-    d.unit = "V";
-    d.valid = true;
-    d.canon_value = v;
-    d.has_canon = true;
-  } else if (invalid) {
-    MarkInvalid(d);
-  } else if (stale) {
-    MarkStale(d);
-  } else if (CanLinkLive(state, now_ms)) {
-    MarkInvalid(d);
-  }
-  return d;
-}
-
-PageRenderData renderTps(const AppState& state, const DataStore& store, uint32_t now_ms) {
-  PageRenderData d{};
-  d.label = "TPS";
-  bool invalid = false;
-  bool stale = false;
-  float v = 0.0f;
-  if (fetch(store, SignalId::kTps, now_ms, v, &invalid, &stale)) {
-    formatFloat1(d.big, sizeof(d.big), v);
-    d.unit = "%";
-    d.valid = true;
-    d.canon_value = v;
-    d.has_canon = true;
-  } else if (invalid) {
-    MarkInvalid(d);
-  } else if (stale) {
-    MarkStale(d);
-  } else if (CanLinkLive(state, now_ms)) {
-    MarkInvalid(d);
-  }
-  return d;
-}
-
-PageRenderData renderAdv(const AppState& state, const DataStore& store, uint32_t now_ms) {
-  PageRenderData d{};
-  d.label = "ADV";
-  bool invalid = false;
-  bool stale = false;
-  float v = 0.0f;
-  if (fetch(store, SignalId::kAdv, now_ms, v, &invalid, &stale)) {
-    formatFloat1(d.big, sizeof(d.big), v);
-    d.unit = "DEG";
-    d.valid = true;
-    d.canon_value = v;
-    d.has_canon = true;
-  } else if (invalid) {
-    MarkInvalid(d);
-  } else if (stale) {
-    MarkStale(d);
-  } else if (CanLinkLive(state, now_ms)) {
-    MarkInvalid(d);
-  }
-  return d;
-}
-
-PageRenderData renderPw1(const AppState& state, const DataStore& store,
-                         uint32_t now_ms) {
-  PageRenderData d{};
-  d.label = "PW1";
-  bool invalid = false;
-  bool stale = false;
-  float v = 0.0f;
-  if (fetch(store, SignalId::kPw1, now_ms, v, &invalid, &stale)) {
-    formatFloat1(d.big, sizeof(d.big), v);
-    d.unit = "ms";
-    d.valid = true;
-    d.canon_value = v;
-    d.has_canon = true;
-  } else if (invalid) {
-    MarkInvalid(d);
-  } else if (stale) {
-    MarkStale(d);
-  } else if (CanLinkLive(state, now_ms)) {
-    MarkInvalid(d);
-  }
-  return d;
-}
-
-PageRenderData renderPw2(const AppState& state, const DataStore& store,
-                         uint32_t now_ms) {
-  PageRenderData d{};
-  d.label = "PW2";
-  bool invalid = false;
-  bool stale = false;
-  float v = 0.0f;
-  if (fetch(store, SignalId::kPw2, now_ms, v, &invalid, &stale)) {
-    formatFloat1(d.big, sizeof(d.big), v);
-    d.unit = "ms";
-    d.valid = true;
-    d.canon_value = v;
-    d.has_canon = true;
-  } else if (invalid) {
-    MarkInvalid(d);
-  } else if (stale) {
-    MarkStale(d);
-  } else if (CanLinkLive(state, now_ms)) {
-    MarkInvalid(d);
-  }
-  return d;
 }
 
-PageRenderData renderPwSeq(const AppState& state, const DataStore& store,
-                           uint32_t now_ms) {
-  PageRenderData d{};
-  d.label = "PWSEQ";
-  bool invalid = false;
-  bool stale = false;
-  float v = 0.0f;
-  if (fetch(store, SignalId::kPwSeq1, now_ms, v, &invalid, &stale)) {
-    formatFloat1(d.big, sizeof(d.big), v);
-    d.unit = "ms";
-    d.valid = true;
-    d.canon_value = v;
-    d.has_canon = true;
-  } else if (invalid) {
+// No usable reading: invalid, then stale, then a live link that should have
+// delivered one; otherwise (no link yet) the page stays blank.
+void markMissing(PageRenderData& d, bool invalid, bool stale, const AppState& state,
+                 uint32_t now_ms) {
+  if (invalid) {
     MarkInvalid(d);
   } else if (stale) {
     MarkStale(d);
   } else if (CanLinkLive(state, now_ms)) {
     MarkInvalid(d);
   }
-  return d;
 }
 
-PageRenderData renderEgo(const AppState& state, const DataStore& store,
-                         uint32_t now_ms) {
-  PageRenderData d{};
-  d.label = "EGO";
+void renderSignal(const PageMeta& m, const AppState& state, const ScreenSettings& cfg,
+                  const SignalSnapshot& snap, uint32_t now_ms, PageRenderData& d) {
   bool invalid = false;
   bool stale = false;
   float v = 0.0f;
-  if (fetch(store, SignalId::kEgoCor1, now_ms, v, &invalid, &stale)) {
-    formatFloat1(d.big, sizeof(d.big), v);
-    d.unit = "%";
-    d.valid = true;
-    d.canon_value = v;
-    d.has_canon = true;
-  } else if (invalid) {
-    MarkInvalid(d);
-  } else if (stale) {
-    MarkStale(d);
-  } else if (CanLinkLive(state, now_ms)) {
-    MarkInvalid(d);
+  if (!fetch(snap, m.signal, v, &invalid, &stale)) {
+    markMissing(d, invalid, stale, state, now_ms);
+    return;
   }
-  return d;
+  formatDecimals(d.big, sizeof(d.big), CanonToDisplay(m.kind, v, cfg), m.decimals);
+  d.unit = unitFor(m, cfg);
+  setValue(d, v);
 }
 
-PageRenderData renderLaunch(const AppState& state, const DataStore& store,
-                            uint32_t now_ms) {
-  PageRenderData d{};
-  d.label = "LCH";
+void renderAfr(const PageMeta& m, const AppState& state, const SignalSnapshot& snap,
+               uint32_t now_ms, PageRenderData& d) {
+  const bool lambda = state.afr_show_lambda;
+  d.label = lambda ? m.alt_label : m.label;
+  d.unit = lambda ? "" : m.unit;
   bool invalid = false;
   bool stale = false;
   float v = 0.0f;
-  if (fetch(store, SignalId::kLaunchTiming, now_ms, v, &invalid, &stale)) {
-    formatFloat1(d.big, sizeof(d.big), v);
-    d.unit = "deg";
-    d.valid = true;
-    d.canon_value = v;
-    d.has_canon = true;
-  } else if (invalid) {
-    MarkInvalid(d);
-  } else if (stale) {
-    MarkStale(d);
-  } else if (CanLinkLive(state, now_ms)) {
-    MarkInvalid(d);
-  }
-  return d;
+  if (!fetch(snap, m.signal, v, &invalid, &stale)) {
+    markMissing(d, invalid, stale, state, now_ms);
+    return;
+  }
+  if (lambda) {
+    const float stoich = (state.stoich_afr < 10.0f)   ? 10.0f
+                         : (state.stoich_afr > 25.0f) ? 25.0f
+                                                      : state.stoich_afr;
+    snprintf(d.big, sizeof(d.big), "%.2f", static_cast<double>(v / stoich));
+  } else {
+    formatDecimals(d.big, sizeof(d.big), v, m.decimals);
+  }
+  setValue(d, v);
+}
+
+// False when the sensor's transform rejects the reading.
+bool formatUserSensor(const PageMeta& m, const UserSensorCfg& us, const ScreenSettings& cfg,
+                      float decoded, PageRenderData& d) {
+  float canon = 0.0f;
+  if (!computeCanonical(us, decoded, canon)) return false;
+  float disp = 0.0f;
+  const char* unit = "";
+  formatDisplay(us, cfg.imperial_units, canon, disp, unit);
+  formatDecimals(d.big, sizeof(d.big), disp, m.decimals);
+  d.unit = unit;
+  setValue(d, canon);
+  return true;
 }
 
-PageRenderData renderTc(const AppState& state, const DataStore& store,
-                        uint32_t now_ms) {
-  PageRenderData d{};
-  d.label = "TC";
+void renderUserSensor(const PageMeta& m, const UserSensorCfg& us, const AppState& state,
+                      const ScreenSettings& cfg, const SignalSnapshot& snap, uint32_t now_ms,
+                      PageRenderData& d) {
+  d.label = us.label[0] ? us.label : defaultLabel(us.preset);
+  const SignalId src = sourceToSignal(us.source);
+  float decoded = 0.0f;
   bool invalid = false;
   bool stale = false;
-  float v = 0.0f;
-  if (fetch(store, SignalId::kTcRetard, now_ms, v, &invalid, &stale)) {
-    formatFloat1(d.big, sizeof(d.big), v);
-    d.unit = "deg";
-    d.valid = true;
-    d.canon_value = v;
-    d.has_canon = true;
+  if (fetch(snap, src, decoded, &invalid, &stale)) {
+    UpdateLastGood(state, src, decoded, now_ms);
+    formatUserSensor(m, us, cfg, decoded, d);
   } else if (invalid) {
     MarkInvalid(d);
   } else if (stale) {
-    MarkStale(d);
-  } else if (CanLinkLive(state, now_ms)) {
-    MarkInvalid(d);
-  }
-  return d;
-}
-
-PageRenderData renderAfr(const AppState& state, const DataStore& store, uint32_t now_ms) {
-  PageRenderData d{};
-  d.label = state.afr_show_lambda ? "LAM" : "AFR";
-  d.unit = state.afr_show_lambda ? "" : "AFR";
-  bool invalid = false;
-  bool stale = false;
-  float v = 0.0f;
-  if (fetch(store, SignalId::kAfr1, now_ms, v, &invalid, &stale)) {
-    float disp = v;
-    if (state.afr_show_lambda) {
-      const float stoich = (state.stoich_afr < 10.0f) ? 10.0f
-                           : (state.stoich_afr > 25.0f) ? 25.0f
-                                                        : state.stoich_afr;
-      if (stoich > 0.0f) {
-        disp = v / stoich;
+    float cached = 0.0f;
+    if (UseLastGood(state, src, now_ms, 2000, cached)) {
+      if (formatUserSensor(m, us, cfg, cached, d)) {
+        strlcpy(d.suffix, "!", sizeof(d.suffix));
       }
-      snprintf(d.big, sizeof(d.big), "%.2f", static_cast<double>(disp));
     } else {
-      formatFloat1(d.big, sizeof(d.big), disp);
+      MarkStale(d);
     }
-    d.valid = true;
-    d.canon_value = v;
-    d.has_canon = true;
-  } else if (invalid) {
-    MarkInvalid(d);
-  } else if (stale) {
-    MarkStale(d);
   } else if (CanLinkLive(state, now_ms)) {
     MarkInvalid(d);
   }
-  return d;
 }
 
-PageRenderData renderAfrTgt(const AppState& state, const DataStore& store, uint32_t now_ms) {
-  PageRenderData d{};
-  d.label = state.afr_show_lambda ? "LAM TG" : "AFR TG";
-  d.unit = state.afr_show_lambda ? "" : "AFR";
-  bool invalid = false;
-  bool stale = false;
-  float v = 0.0f;
-  if (fetch(store, SignalId::kAfrTarget1, now_ms, v, &invalid, &stale)) {
-    float disp = v;
-    if (state.afr_show_lambda) {
-      const float stoich = (state.stoich_afr < 10.0f) ? 10.0f
-                           : (state.stoich_afr > 25.0f) ? 25.0f
-                                                        : state.stoich_afr;
-      if (stoich > 0.0f) {
-        disp = v / stoich;
-      }
-      snprintf(d.big, sizeof(d.big), "%.2f", static_cast<double>(disp));
-    } else {
-      formatFloat1(d.big, sizeof(d.big), disp);
-    }
-    d.valid = true;
-    d.canon_value = v;
-    d.has_canon = true;
-  } else if (invalid) {
-    MarkInvalid(d);
-  } else if (stale) {
-    MarkStale(d);
-  } else if (CanLinkLive(state, now_ms)) {
-    MarkInvalid(d);
+// Rounded integer pressure; a stale MAP holds its last good value briefly.
+void renderMap(const PageMeta& m, const AppState& state, const ScreenSettings& cfg,
+               const SignalSnapshot& snap, uint32_t now_ms, PageRenderData& d) {
+#ifdef DEBUG_STALE_OLED2
+  static uint32_t last_map_dbg_ms = 0;
+  if ((now_ms - last_map_dbg_ms) >= 1000U) {
+    const SignalRead dbg = snap.get(m.signal);
+    LOGV("[MAPDBG] t=%lu age=%lu flags=0x%02X valid=%d val=%.3f\n",
+         static_cast<unsigned long>(now_ms),
+         static_cast<unsigned long>(dbg.age_ms), dbg.flags, dbg.valid,
+         static_cast<double>(dbg.value));
+    (void)dbg;
+    last_map_dbg_ms = now_ms;
   }
-  return d;
-}
-
-PageRenderData renderKnk(const AppState& state, const DataStore& store, uint32_t now_ms) {
-  PageRenderData d{};
-  d.label = "KNK";
+#endif
   bool invalid = false;
   bool stale = false;
-  float v = 0.0f;
-  if (fetch(store, SignalId::kKnkRetard, now_ms, v, &invalid, &stale)) {
-    formatFloat1(d.big, sizeof(d.big), v);
-    d.unit = "deg";
-    d.valid = true;
-    d.canon_value = v;
-    d.has_canon = true;
+  float map_kpa = 0.0f;
+  if (fetch(snap, m.signal, map_kpa, &invalid, &stale)) {
+    UpdateLastGood(state, m.signal, map_kpa, now_ms);
   } else if (invalid) {
     MarkInvalid(d);
-  } else if (stale) {
-    MarkStale(d);
-  } else if (CanLinkLive(state, now_ms)) {
-    MarkInvalid(d);
+    return;
+  } else if (stale && UseLastGood(state, m.signal, now_ms, 2000, map_kpa)) {
+    strlcpy(d.suffix, "!", sizeof(d.suffix));
+  } else {
+    if (stale) {
+      MarkStale(d);
+#ifdef DEBUG_STALE_OLED2
+      const SignalRead r = snap.get(m.signal);
+      LOGV("[STALE] MAP render stale: t=%lu age=%lu flags=0x%02X val=%.3f\n",
+           static_cast<unsigned long>(now_ms),
+           static_cast<unsigned long>(r.age_ms), r.flags,
+           static_cast<double>(r.value));
+      (void)r;
+#endif
+    }
+    return;
   }
-  return d;
+  const float val = CanonToDisplay(m.kind, map_kpa, cfg);
+  formatInt(d.big, sizeof(d.big), static_cast<uint32_t>(val + 0.5f));  // rounded integer
+  d.unit = unitFor(m, cfg);
+  setValue(d, map_kpa);
 }
 
-PageRenderData renderVss(const AppState& state, const ScreenSettings& cfg,
-                         const DataStore& store, uint32_t now_ms) {
-  PageRenderData d{};
-  d.label = "VSS";
+// Boost against the acquired baro, or a 100 kPa guess marked "(est)". An
+// invalid MAP keeps its INV marker but still draws (from 0 kPa).
+void renderBoost(const PageMeta& m, const AppState& state, const ScreenSettings& cfg,
+                 const SignalSnapshot& snap, uint32_t now_ms, PageRenderData& d) {
   bool invalid = false;
   bool stale = false;
-  float v = 0.0f;
-  if (fetch(store, SignalId::kVss1, now_ms, v, &invalid, &stale)) {
-    const float val = cfg.imperial_units ? v * kMsToMph : v * kMsToKmh;
-    formatFloat1(d.big, sizeof(d.big), val);
-    d.unit = cfg.imperial_units ? "mph" : "km/h";
-    d.valid = true;
-    d.canon_value = v;
-    d.has_canon = true;
-  } else if (invalid) {
-    MarkInvalid(d);
-  } else if (stale) {
-    MarkStale(d);
-  } else if (CanLinkLive(state, now_ms)) {
-    MarkInvalid(d);
+  float map_kpa = 0.0f;
+  if (!fetch(snap, m.signal, map_kpa, &invalid, &stale)) {
+    if (invalid) {
+      MarkInvalid(d);
+    } else if (stale && !UseLastGood(state, m.signal, now_ms, 2000, map_kpa)) {
+      MarkStale(d);
+      return;
+    }
   }
-  return d;
-}
-
-PageRenderData renderEgt(const AppState& state, const ScreenSettings& cfg,
-                         const DataStore& store, uint32_t now_ms) {
-  PageRenderData d{};
-  d.label = "EGT";
-  bool invalid = false;
-  bool stale = false;
-  float v = 0.0f;
-  if (fetch(store, SignalId::kEgt1, now_ms, v, &invalid, &stale)) {
-    float disp = cfg.imperial_units ? v : f_to_c(v);
-    formatInt(d.big, sizeof(d.big), static_cast<uint32_t>(disp));
-    d.unit = cfg.imperial_units ? "F" : "C";
-    d.valid = true;
-    d.canon_value = v;
-    d.has_canon = true;
-  } else if (invalid) {
-    MarkInvalid(d);
-  } else if (stale) {
-    MarkStale(d);
-  } else if (CanLinkLive(state, now_ms)) {
-    MarkInvalid(d);
+  UpdateLastGood(state, m.signal, map_kpa, now_ms);
+  const bool baro_ok = state.baro_acquired;
+  const float boost_kpa = map_kpa - (baro_ok ? state.baro_kpa : 100.0f);
+  formatDecimals(d.big, sizeof(d.big), CanonToDisplay(ValueKind::kBoost, boost_kpa, cfg),
+                 m.decimals);
+  d.unit = unitFor(m, cfg);
+  if (stale) {
+    strlcpy(d.suffix, "!", sizeof(d.suffix));
   }
-  return d;
+  if (!baro_ok) {
+    strlcpy(d.suffix, "(est)", sizeof(d.suffix));
+  }
+  setValue(d, boost_kpa);
+  d.has_canon = baro_ok;
 }
 
 }  // namespace
@@ -878,124 +459,65 @@ bool IsOnGrid(float disp, const ThresholdGrid& g) {
 }
 
 PageRenderData BuildPageData(PageId id, const AppState& state,
-                             const ScreenSettings& cfg, const DataStore& store,
+                             const ScreenSettings& cfg, const SignalSnapshot& snap,
                              uint32_t now_ms) {
+  PageRenderData d{};
+  const PageMeta* m = FindPageMeta(id);
+  if (!m) return d;
+  d.label = m->label;
+  switch (m->render) {
+    case PageRender::kSignal:
+      renderSignal(*m, state, cfg, snap, now_ms, d);
+      break;
+    case PageRender::kUserSensor0:
+    case PageRender::kUserSensor1:
+      renderUserSensor(*m, *userSensorFor(*m, state), state, cfg, snap, now_ms, d);
+      break;
+    case PageRender::kMapAbs:
+      renderMap(*m, state, cfg, snap, now_ms, d);
+      break;
+    case PageRender::kBoost:
+      renderBoost(*m, state, cfg, snap, now_ms, d);
+      break;
+    case PageRender::kAfr:
+      renderAfr(*m, state, snap, now_ms, d);
+      break;
+  }
+  return d;
+}
+
+bool PageSourceSignal(PageId id, const AppState& state, SignalId& out) {
+  const PageMeta* m = FindPageMeta(id);
+  if (!m) return false;
+  const UserSensorCfg* us = userSensorFor(*m, state);
+  out = us ? sourceToSignal(us->source) : m->signal;
+  return true;
+}
+
+bool PageCanonicalFromSignal(PageId id, const AppState& state, float value,
+                             float& out) {
   switch (id) {
     case PageId::kOilP:
-      return renderOilP(state, cfg, store, now_ms);
+      return computeCanonical(state.user_sensor[0], value, out);
     case PageId::kOilT:
-      return renderOilT(state, cfg, store, now_ms);
+      return computeCanonical(state.user_sensor[1], value, out);
     case PageId::kBoost:
-      return renderBoost(state, store, cfg, now_ms);
-    case PageId::kMapAbs:
-      return renderMap(state, store, cfg, now_ms);
-    case PageId::kRpm:
-      return renderRpm(state, store, now_ms);
-    case PageId::kClt:
-      return renderClt(state, cfg, store, now_ms);
-    case PageId::kMat:
-      return renderMat(state, cfg, store, now_ms);
-    case PageId::kBatt:
-      return renderBatt(state, store, now_ms);
-    case PageId::kTps:
-      return renderTps(state, store, now_ms);
-    case PageId::kAdv:
-      return renderAdv(state, store, now_ms);
-    case PageId::kAfr1:
-      return renderAfr(state, store, now_ms);
-    case PageId::kAfrTgt:
-      return renderAfrTgt(state, store, now_ms);
-    case PageId::kKnk:
-      return renderKnk(state, store, now_ms);
-    case PageId::kVss:
-      return renderVss(state, cfg, store, now_ms);
-    case PageId::kEgt1:
-      return renderEgt(state, cfg, store, now_ms);
-    case PageId::kPw1:
-      return renderPw1(state, store, now_ms);
-    case PageId::kPw2:
-      return renderPw2(state, store, now_ms);
-    case PageId::kPwSeq:
-      return renderPwSeq(state, store, now_ms);
-    case PageId::kEgo:
-      return renderEgo(state, store, now_ms);
-    case PageId::kLaunch:
-      return renderLaunch(state, store, now_ms);
-    case PageId::kTc:
-      return renderTc(state, store, now_ms);
+      if (!state.baro_acquired) return false;
+      out = value - state.baro_kpa;
+      return true;
     default:
-      return {};
+      out = value;
+      return true;
   }
 }
 
 bool PageCanonicalValue(PageId id, const AppState& state,
-                        const ScreenSettings& cfg, const DataStore& store,
+                        const ScreenSettings& cfg, const SignalSnapshot& snap,
                         uint32_t now_ms, float& out) {
-  switch (id) {
-    case PageId::kOilP: {
-      const UserSensorCfg cfg_us = state.user_sensor[0];
-      const SignalId src = sourceToSignal(cfg_us.source);
-      float decoded = 0.0f;
-      if (!fetch(store, src, now_ms, decoded)) return false;
-      float canon = 0.0f;
-      if (!computeCanonical(cfg_us, decoded, canon)) return false;
-      out = canon;
-      return true;
-    }
-    case PageId::kOilT: {
-      const UserSensorCfg cfg_us = state.user_sensor[1];
-      const SignalId src = sourceToSignal(cfg_us.source);
-      float decoded = 0.0f;
-      if (!fetch(store, src, now_ms, decoded)) return false;
-      float canon = 0.0f;
-      if (!computeCanonical(cfg_us, decoded, canon)) return false;
-      out = canon;
-      return true;
-    }
-    case PageId::kBoost: {
-      if (!state.baro_acquired) return false;
-      float map = 0.0f;
-      if (!fetch(store, SignalId::kMap, now_ms, map)) return false;
-      out = map - state.baro_kpa;
-      return true;
-    }
-    case PageId::kMapAbs:
-      return fetch(store, SignalId::kMap, now_ms, out);
-    case PageId::kRpm:
-      return fetch(store, SignalId::kRpm, now_ms, out);
-    case PageId::kClt:
-      return fetch(store, SignalId::kClt, now_ms, out);
-    case PageId::kMat:
-      return fetch(store, SignalId::kMat, now_ms, out);
-    case PageId::kBatt:
-      return fetch(store, SignalId::kBatt, now_ms, out);
-    case PageId::kTps:
-      return fetch(store, SignalId::kTps, now_ms, out);
-    case PageId::kAdv:
-      return fetch(store, SignalId::kAdv, now_ms, out);
-    case PageId::kAfr1:
-      return fetch(store, SignalId::kAfr1, now_ms, out);
-    case PageId::kAfrTgt:
-      return fetch(store, SignalId::kAfrTarget1, now_ms, out);
-    case PageId::kKnk:
-      return fetch(store, SignalId::kKnkRetard, now_ms, out);
-    case PageId::kVss:
-      return fetch(store, SignalId::kVss1, now_ms, out);
-    case PageId::kEgt1:
-      return fetch(store, SignalId::kEgt1, now_ms, out);
-    case PageId::kPw1:
-      return fetch(store, SignalId::kPw1, now_ms, out);
-    case PageId::kPw2:
-      return fetch(store, SignalId::kPw2, now_ms, out);
-    case PageId::kPwSeq:
-      return fetch(store, SignalId::kPwSeq1, now_ms, out);
-    case PageId::kEgo:
-      return fetch(store, SignalId::kEgoCor1, now_ms, out);
-    case PageId::kLaunch:
-      return fetch(store, SignalId::kLaunchTiming, now_ms, out);
-    case PageId::kTc:
-      return fetch(store, SignalId::kTcRetard, now_ms, out);
-    default:
-      return false;
-  }
+  (void)now_ms;  // ages were resolved when the snapshot was taken
+  SignalId src;
+  if (!PageSourceSignal(id, state, src)) return false;
+  float value = 0.0f;
+  if (!fetch(snap, src, value)) return false;
+  return PageCanonicalFromSignal(id, state, value, out);
 }
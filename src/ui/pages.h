@@ -62,12 +62,28 @@ enum class ValueKind : uint8_t {
   kNone
 };
 
+// How BuildPageData turns a page's source signal into text.
+enum class PageRender : uint8_t {
+  kSignal,       // CanonToDisplay(kind), `decimals`, unit pair
+  kUserSensor0,  // user_sensor[0]: source, transform, label and units from config
+  kUserSensor1,  // user_sensor[1]
+  kMapAbs,       // rounded integer; holds the last good value while stale
+  kBoost,        // MAP minus baro, "(est)" until baro is acquired
+  kAfr,          // AFR, or lambda (`alt_label`) when state.afr_show_lambda
+};
+
 struct PageMeta {
   PageId id;
   const char* label;
   ValueKind kind;
   bool has_min;
   bool has_max;
+  PageRender render;
+  SignalId signal;  // unused by user-sensor pages (their config picks it)
+  uint8_t decimals;  // 0: whole units, truncated
+  const char* unit;
+  const char* unit_imperial;
+  const char* alt_label;
 };
 
 struct ThresholdGrid {
@@ -81,11 +97,17 @@ const PageDef* GetPageTable(size_t& count);
 const PageMeta* GetPageMeta(size_t& count);
 const PageMeta* FindPageMeta(PageId id);
 PageRenderData BuildPageData(PageId id, const AppState& state,
-                             const ScreenSettings& cfg, const DataStore& store,
+                             const ScreenSettings& cfg, const SignalSnapshot& snap,
                              uint32_t now_ms);
 bool PageCanonicalValue(PageId id, const AppState& state,
-                        const ScreenSettings& cfg, const DataStore& store,
+                        const ScreenSettings& cfg, const SignalSnapshot& snap,
                         uint32_t now_ms, float& out);
+// Signal a page is derived from (user-sensor pages follow their source).
+bool PageSourceSignal(PageId id, const AppState& state, SignalId& out);
+// Page canonical value for a raw reading of its source signal. Transforms are
+// monotonic, so extrema map to extrema.
+bool PageCanonicalFromSignal(PageId id, const AppState& state, float value,
+                             float& out);
 float ThresholdStep(ValueKind kind);
 float CanonToDisplay(ValueKind kind, float canon, const ScreenSettings& cfg);
 float DisplayToCanon(ValueKind kind, float display, const ScreenSettings& cfg);
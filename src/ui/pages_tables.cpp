@@ -2,28 +2,50 @@
 
 namespace {
 
+// One row per page: adding a plain signal page is a row here plus its PageId.
 const PageMeta kPageMeta[] = {
-    {PageId::kOilP, "OILP", ValueKind::kPressure, true, false},
-    {PageId::kOilT, "OILT", ValueKind::kTemp, false, true},
-    {PageId::kBoost, "BOOST", ValueKind::kPressure, true, true},
-    {PageId::kMapAbs, "MAP", ValueKind::kPressure, true, true},
-    {PageId::kRpm, "RPM", ValueKind::kRpm, true, true},
-    {PageId::kClt, "CLT", ValueKind::kTemp, true, true},
-    {PageId::kMat, "IAT", ValueKind::kTemp, true, true},
-    {PageId::kBatt, "BATT", ValueKind::kVoltage, true, true},
-    {PageId::kTps, "TPS", ValueKind::kPercent, true, true},
-    {PageId::kAdv, "ADV", ValueKind::kDeg, true, true},
-    {PageId::kAfr1, "AFR", ValueKind::kAfr, true, true},
-    {PageId::kAfrTgt, "AFR TG", ValueKind::kAfr, true, true},
-    {PageId::kKnk, "KNK", ValueKind::kDeg, false, true},
-    {PageId::kVss, "VSS", ValueKind::kSpeed, true, true},
-    {PageId::kEgt1, "EGT", ValueKind::kTemp, true, true},
-    {PageId::kPw1, "PW1", ValueKind::kNone, false, true},
-    {PageId::kPw2, "PW2", ValueKind::kNone, false, true},
-    {PageId::kPwSeq, "PWSEQ", ValueKind::kNone, false, true},
-    {PageId::kEgo, "EGO", ValueKind::kPercent, true, true},
-    {PageId::kLaunch, "LCH", ValueKind::kDeg, true, true},
-    {PageId::kTc, "TC", ValueKind::kDeg, true, true}};
+    {PageId::kOilP, "OILP", ValueKind::kPressure, true, false, PageRender::kUserSensor0,
+     SignalId::kCount, 1, "", "", nullptr},
+    {PageId::kOilT, "OILT", ValueKind::kTemp, false, true, PageRender::kUserSensor1,
+     SignalId::kCount, 1, "", "", nullptr},
+    {PageId::kBoost, "BOOST", ValueKind::kPressure, true, true, PageRender::kBoost,
+     SignalId::kMap, 1, "kPa", "psi", nullptr},
+    {PageId::kMapAbs, "MAP", ValueKind::kPressure, true, true, PageRender::kMapAbs,
+     SignalId::kMap, 0, "kPa", "psi", nullptr},
+    {PageId::kRpm, "RPM", ValueKind::kRpm, true, true, PageRender::kSignal, SignalId::kRpm, 0,
+     "rpm", "rpm", nullptr},
+    {PageId::kClt, "CLT", ValueKind::kTemp, true, true, PageRender::kSignal, SignalId::kClt, 0,
+     "C", "F", nullptr},
+    {PageId::kMat, "IAT", ValueKind::kTemp, true, true, PageRender::kSignal, SignalId::kMat, 0,
+     "C", "F", nullptr},
+    {PageId::kBatt, "BATT", ValueKind::kVoltage, true, true, PageRender::kSignal,
+     SignalId::kBatt, 1, "V", "V", nullptr},
+    {PageId::kTps, "TPS", ValueKind::kPercent, true, true, PageRender::kSignal, SignalId::kTps,
+     1, "%", "%", nullptr},
+    {PageId::kAdv, "ADV", ValueKind::kDeg, true, true, PageRender::kSignal, SignalId::kAdv, 1,
+     "DEG", "DEG", nullptr},
+    {PageId::kAfr1, "AFR", ValueKind::kAfr, true, true, PageRender::kAfr, SignalId::kAfr1, 1,
+     "AFR", "AFR", "LAM"},
+    {PageId::kAfrTgt, "AFR TG", ValueKind::kAfr, true, true, PageRender::kAfr,
+     SignalId::kAfrTarget1, 1, "AFR", "AFR", "LAM TG"},
+    {PageId::kKnk, "KNK", ValueKind::kDeg, false, true, PageRender::kSignal,
+     SignalId::kKnkRetard, 1, "deg", "deg", nullptr},
+    {PageId::kVss, "VSS", ValueKind::kSpeed, true, true, PageRender::kSignal, SignalId::kVss1,
+     1, "km/h", "mph", nullptr},
+    {PageId::kEgt1, "EGT", ValueKind::kTemp, true, true, PageRender::kSignal, SignalId::kEgt1,
+     0, "C", "F", nullptr},
+    {PageId::kPw1, "PW1", ValueKind::kNone, false, true, PageRender::kSignal, SignalId::kPw1, 1,
+     "ms", "ms", nullptr},
+    {PageId::kPw2, "PW2", ValueKind::kNone, false, true, PageRender::kSignal, SignalId::kPw2, 1,
+     "ms", "ms", nullptr},
+    {PageId::kPwSeq, "PWSEQ", ValueKind::kNone, false, true, PageRender::kSignal,
+     SignalId::kPwSeq1, 1, "ms", "ms", nullptr},
+    {PageId::kEgo, "EGO", ValueKind::kPercent, true, true, PageRender::kSignal,
+     SignalId::kEgoCor1, 1, "%", "%", nullptr},
+    {PageId::kLaunch, "LCH", ValueKind::kDeg, true, true, PageRender::kSignal,
+     SignalId::kLaunchTiming, 1, "deg", "deg", nullptr},
+    {PageId::kTc, "TC", ValueKind::kDeg, true, true, PageRender::kSignal, SignalId::kTcRetard,
+     1, "deg", "deg", nullptr}};
 
 const PageDef kPages[] = {
     {PageId::kOilP, "OILP"},   {PageId::kOilT, "OILT"},
@@ -0,0 +1,33 @@
+#include "ui/render_stats.h"
+
+void RenderStats::tick(uint32_t now_ms) {
+  if (!started_) {
+    started_ = true;
+    window_start_ms_ = now_ms;
+    return;
+  }
+  if (armed_ && (now_ms - last_read_ms_) >= kArmMs) armed_ = false;
+  const uint32_t elapsed = now_ms - window_start_ms_;
+  if (elapsed < kWindowMs) return;
+  for (uint8_t z = 0; z < kZones; ++z) {
+    shown_[z] = live_[z];
+    live_[z] = Zone();
+  }
+  shown_window_ms_ = elapsed;
+  window_start_ms_ = now_ms;
+}
+
+void RenderStats::record(uint8_t zone, Stage stage, uint32_t us) {
+  if (zone >= kZones || stage >= kStageCount) return;
+  Timing& t = live_[zone].stage[stage];
+  if (t.samples == 0 || us < t.min_us) t.min_us = us;
+  if (us > t.max_us) t.max_us = us;
+  t.sum_us += us;
+  ++t.samples;
+}
+
+const RenderStats::Zone& RenderStats::zone(uint8_t zone, uint32_t now_ms) {
+  last_read_ms_ = now_ms;
+  armed_ = true;
+  return shown_[zone < kZones ? zone : 0];
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <stdint.h>
+
+// Per-zone render pipeline counters: time spent in BuildPageData, drawing
+// and the frame send, plus frames drawn and frames skipped (refresh
+// interval not yet due, or nothing changed). Collected over a fixed window
+// and published when the window rolls; readers always see the last
+// complete window. Skip counts are plain increments; the micros() timing
+// only runs while someone has read the stats recently, so an unwatched
+// device pays a couple of branches per zone.
+class RenderStats {
+ public:
+  static constexpr uint8_t kZones = 3;
+  static constexpr uint32_t kWindowMs = 2000;
+  // Timing stays on this long after the last read.
+  static constexpr uint32_t kArmMs = 5000;
+
+  enum Stage : uint8_t { kBuild = 0, kDraw, kSend, kStageCount };
+
+  struct Timing {
+    uint32_t min_us = 0;
+    uint32_t max_us = 0;
+    uint32_t sum_us = 0;
+    uint16_t samples = 0;
+    uint32_t avgUs() const { return samples ? sum_us / samples : 0; }
+  };
+  struct Zone {
+    Timing stage[kStageCount];
+    uint16_t frames = 0;
+    uint16_t skipped_interval = 0;
+    uint16_t skipped_unchanged = 0;
+  };
+
+  // Once per render pass; publishes the window when it is over.
+  void tick(uint32_t now_ms);
+  bool timing() const { return armed_; }
+  void record(uint8_t zone, Stage stage, uint32_t us);
+  void countFrame(uint8_t zone) { if (zone < kZones) ++live_[zone].frames; }
+  void countSkipInterval(uint8_t zone) {
+    if (zone < kZones) ++live_[zone].skipped_interval;
+  }
+  void countSkipUnchanged(uint8_t zone) {
+    if (zone < kZones) ++live_[zone].skipped_unchanged;
+  }
+
+  // Last complete window; reading (re)arms the timing.
+  const Zone& zone(uint8_t zone, uint32_t now_ms);
+  // Length of the published window (0 before the first one).
+  uint32_t windowMs() const { return shown_window_ms_; }
+
+ private:
+  Zone live_[kZones];
+  Zone shown_[kZones];
+  uint32_t window_start_ms_ = 0;
+  uint32_t shown_window_ms_ = 0;
+  uint32_t last_read_ms_ = 0;
+  bool started_ = false;
+  bool armed_ = false;
+};
@@ -8,9 +8,22 @@
 #include "app/can_runtime.h"
 #include "app/can_state_snapshot.h"
 #include "can_rx.h"
+#include "data/signal_contract.h"
+#include "data/signal_health.h"
+#include "ui_render.h"
 
 namespace {
 
+constexpr uint8_t kCanDiagPages = 6;
+constexpr size_t kHealthCount = static_cast<size_t>(SignalId::kCount);
+
+// Worst offenders first: rejects, then dropouts, then busiest.
+bool HealthWorse(const SignalHealthStats& a, const SignalHealthStats& b) {
+  if (a.rejects != b.rejects) return a.rejects > b.rejects;
+  if (a.stale_events != b.stale_events) return a.stale_events > b.stale_events;
+  return a.updates > b.updates;
+}
+
 const char* TwaiStateStr(uint8_t st, bool passive_hint) {
   switch (st) {
     case 1:
@@ -70,11 +83,12 @@ void HandleCanDiagnosticsAction(UiAction action, uint8_t& can_diag_page,
       }
       break;
     case UiAction::kClick1:
-      can_diag_page = static_cast<uint8_t>((can_diag_page + 1) % 4);
+      can_diag_page = static_cast<uint8_t>((can_diag_page + 1) % kCanDiagPages);
       break;
     case UiAction::kLong:
     case UiAction::kClick1Long:
-      can_diag_page = static_cast<uint8_t>((can_diag_page + 4 - 1) % 4);
+      can_diag_page =
+          static_cast<uint8_t>((can_diag_page + kCanDiagPages - 1) % kCanDiagPages);
       break;
     case UiAction::kClick3:
       request_exit = true;
@@ -104,10 +118,12 @@ void RenderCanDiagnostics(OledU8g2& display, uint8_t viewport_y,
   static CanRxSnapshot s_snap{};
   static uint32_t s_snap_ms = 0;
   static CanRxCounters s_cnt{};
+  static SignalHealthStats s_health[kHealthCount];
   const uint32_t now_ms = millis();
   if ((now_ms - s_snap_ms) > 50U) {  // ~20 Hz
     canrx_get_snapshot(s_snap);
     canrx_get_counters(s_cnt);
+    g_datastore_can.readHealth(s_health, kHealthCount, now_ms);
     s_snap_ms = now_ms;
   }
   CanStateSnapshot can_state{};
@@ -246,6 +262,73 @@ void RenderCanDiagnostics(OledU8g2& display, uint8_t viewport_y,
       }
       break;
     }
+    case 4: {
+      // Per-signal table: name, Hz, rejects, invalid-hold s, stale gaps.
+      draw("P4 SIG HZ REJ INV STL");
+      uint8_t order[kHealthCount];
+      uint8_t n = 0;
+      for (size_t i = 0; i < kHealthCount; ++i) {
+        if (s_health[i].last_ms == 0) continue;
+        uint8_t k = n++;
+        while (k > 0 && HealthWorse(s_health[i], s_health[order[k - 1]])) {
+          order[k] = order[k - 1];
+          --k;
+        }
+        order[k] = static_cast<uint8_t>(i);
+      }
+      if (n == 0) {
+        draw("no signals yet");
+        break;
+      }
+      for (uint8_t k = 0; k < n && y < max_y; ++k) {
+        const SignalHealthStats& h = s_health[order[k]];
+        const SignalContractEntry* ent =
+            LookupSignalContract(static_cast<SignalId>(order[k]));
+        snprintf(buf, sizeof(buf), "%-6.6s%3.0f R%lu I%lus S%u",
+                 ent ? ent->name : "?", static_cast<double>(h.rate_hz),
+                 static_cast<unsigned long>(h.rejects),
+                 static_cast<unsigned long>(h.invalid_ms / 1000U),
+                 static_cast<unsigned>(h.stale_events));
+        draw(buf);
+      }
+      break;
+    }
+    case 5: {
+      // Render pipeline, last window: BuildPageData / draw / send time as
+      // avg/max us, then frames drawn and skipped (I: interval, U: unchanged).
+      RenderStats& stats = UiRenderStats();
+      uint8_t zones[RenderStats::kZones];
+      uint8_t n = 0;
+      for (uint8_t z = 0; z < RenderStats::kZones; ++z) {
+        const RenderStats::Zone& zs = stats.zone(z, now_ms);
+        if (zs.frames || zs.skipped_interval || zs.skipped_unchanged) zones[n++] = z;
+      }
+      if (n == 0) {
+        draw("P5 RENDER (sampling)");
+        break;
+      }
+      // Two lines per zone; small viewports cycle through the zones.
+      const uint8_t first = static_cast<uint8_t>((now_ms / RenderStats::kWindowMs) % n);
+      for (uint8_t k = 0; k < n && y < max_y; ++k) {
+        const uint8_t z = zones[(first + k) % n];
+        const RenderStats::Zone& zs = stats.zone(z, now_ms);
+        const RenderStats::Timing* t = zs.stage;
+        snprintf(buf, sizeof(buf), "Z%u B%lu/%lu D%lu/%lu", static_cast<unsigned>(z),
+                 static_cast<unsigned long>(t[RenderStats::kBuild].avgUs()),
+                 static_cast<unsigned long>(t[RenderStats::kBuild].max_us),
+                 static_cast<unsigned long>(t[RenderStats::kDraw].avgUs()),
+                 static_cast<unsigned long>(t[RenderStats::kDraw].max_us));
+        draw(buf);
+        snprintf(buf, sizeof(buf), " S%lu/%lu F%u I%u U%u",
+                 static_cast<unsigned long>(t[RenderStats::kSend].avgUs()),
+                 static_cast<unsigned long>(t[RenderStats::kSend].max_us),
+                 static_cast<unsigned>(zs.frames),
+                 static_cast<unsigned>(zs.skipped_interval),
+                 static_cast<unsigned>(zs.skipped_unchanged));
+        draw(buf);
+      }
+      break;
+    }
     default:
       break;
   }
@@ -471,7 +471,7 @@ void UiMenu::render(OledU8g2& display, const ScreenSettings& cfg,
         break;
       }
       case PageSetupItem::kHidePage: {
-        const bool hidden = (ui.page_hidden_mask & (1U << safe_page)) != 0;
+        const bool hidden = ui.page_hidden_mask.test(safe_page);
         snprintf(line2, sizeof(line2), "%s Hide: %s", label,
                  hidden ? "On" : "Off");
         break;
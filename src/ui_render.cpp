@@ -157,8 +157,93 @@ static const char* CanOverlayReason(const AppState& s, uint32_t now_ms) {
   }
 }
 
+static_assert(RenderStats::kZones == kMaxZones, "render stats cover every zone");
+RenderStats g_render_stats;
+
+// Draw and send time of one zone frame. Send time is what the display's
+// send call blocked for (the bus transfer when synchronous, the back-buffer
+// copy when the display task streams it); draw time is the rest.
+struct ZoneTimer {
+  bool on = false;
+  uint32_t start_us = 0;
+  uint32_t blocked_before_us = 0;
+};
+
+ZoneTimer StartZoneTimer(const OledU8g2& disp) {
+  ZoneTimer t;
+  t.on = g_render_stats.timing();
+  if (t.on) {
+    t.blocked_before_us = disp.sendBlockedUs();
+    t.start_us = micros();
+  }
+  return t;
+}
+
+void FinishZoneTimer(const ZoneTimer& t, const OledU8g2& disp, uint8_t zone) {
+  g_render_stats.countFrame(zone);
+  if (!t.on) return;
+  const uint32_t total_us = micros() - t.start_us;
+  const uint32_t send_us = disp.sendBlockedUs() - t.blocked_before_us;
+  g_render_stats.record(zone, RenderStats::kDraw,
+                        total_us > send_us ? total_us - send_us : 0);
+  if (send_us > 0) g_render_stats.record(zone, RenderStats::kSend, send_us);
+}
+
+// What a renderScreen call did to its display's buffer.
+enum class ZoneFrame : uint8_t { kNone, kDrawn, kUnchanged };
+
+// FNV-1a over everything a metric zone puts on the panel.
+class Fingerprint {
+ public:
+  void add(const char* s) {
+    if (!s) {
+      mix(0xFF);
+      return;
+    }
+    while (*s) mix(static_cast<uint8_t>(*s++));
+    mix(0);
+  }
+  void add(uint32_t v) {
+    for (uint8_t i = 0; i < 4; ++i) mix(static_cast<uint8_t>(v >> (8 * i)));
+  }
+  // Never 0, which RenderState uses for "nothing known".
+  uint32_t value() const { return hash_ ? hash_ : 1; }
+
+ private:
+  void mix(uint8_t b) { hash_ = (hash_ ^ b) * 16777619u; }
+  uint32_t hash_ = 2166136261u;
+};
+
+// Zone 0's pixels of a shared 128x64 panel (top zone, which clears the
+// buffer); zone 1 starts from it when it redraws alone.
+uint8_t g_top_layer[OledU8g2::kFrameBytes];
+bool g_top_layer_valid = false;
+
+// Zones whose pixels live in `disp`'s buffer: after something else wiped
+// it, their next frame must be drawn.
+void ForgetZoneFrames(AppState& state, OledU8g2& oled_primary, OledU8g2& oled_secondary,
+                      const OledU8g2& disp) {
+  for (uint8_t z = 0; z < kMaxZones; ++z) {
+    if (&screenDisplay(state, oled_primary, oled_secondary, z) == &disp) {
+      state.render_state[z].last_fingerprint = 0;
+    }
+  }
+}
+
+// `disp` just sent its buffer: every zone drawn into it is on the panel.
+void MarkZoneFramesSent(AppState& state, OledU8g2& oled_primary, OledU8g2& oled_secondary,
+                        const OledU8g2& disp) {
+  for (uint8_t z = 0; z < kMaxZones; ++z) {
+    if (&screenDisplay(state, oled_primary, oled_secondary, z) == &disp) {
+      state.render_state[z].last_epoch = disp.frameEpoch();
+    }
+  }
+}
+
 }  // namespace
 
+RenderStats& UiRenderStats() { return g_render_stats; }
+
 void resetMaxForFocusPage(AppState& state, uint32_t now_ms) {
   const uint8_t focus = state.dual_screens ? state.focus_screen : 0;
   const uint8_t page = state.page_index[focus] % kPageCount;
@@ -166,14 +251,14 @@ void resetMaxForFocusPage(AppState& state, uint32_t now_ms) {
   state.max_blink_page[focus] = page;
 }
 
-void renderScreen(AppState& state, OledU8g2& oled_primary,
-                  OledU8g2& oled_secondary, const DataStore& store,
-                  const AlertsEngine& alerts, uint8_t screen_index,
-                  uint32_t now_ms, bool allow_refresh, uint8_t viewport_y = 0,
-                  uint8_t viewport_h = 0, bool clear_buffer = true,
-                  bool send_buffer = true) {
+ZoneFrame renderScreen(AppState& state, OledU8g2& oled_primary,
+                       OledU8g2& oled_secondary, const SignalSnapshot& snap,
+                       const AlertsEngine& alerts, uint8_t screen_index,
+                       uint32_t now_ms, bool allow_refresh, uint8_t viewport_y = 0,
+                       uint8_t viewport_h = 0, bool clear_buffer = true,
+                       bool send_buffer = true, const uint8_t* base_layer = nullptr) {
   if (!logicalScreenReady(state, screen_index)) {
-    return;
+    return ZoneFrame::kNone;
   }
   size_t page_count = 0;
   const PageDef* pages = GetPageTable(page_count);
@@ -224,8 +309,22 @@ void renderScreen(AppState& state, OledU8g2& oled_primary,
       rs.last_invert = false;
     }
   }
+  // Max/min reset feedback flashes the zone. With the panel to itself that
+  // is the panel's invert bit (one command per phase, no frame); a zone
+  // sharing its panel is redrawn inverted, which only moves its own tiles.
+  const bool max_blink_active =
+      now_ms < state.max_blink_until_ms[screen_index] &&
+      page == state.max_blink_page[screen_index];
+  const uint8_t maxblink_phase =
+      max_blink_active ? static_cast<uint8_t>((now_ms / 120U) & 0x1U) : 0;
+  const bool flash_on = maxblink_phase != 0 && !in_menu;
+  disp_obj.setFlash(flash_on && !shared_viewport);
 
-  PageRenderData data = BuildPageData(def.id, state, display_cfg, store, now_ms);
+  const uint32_t build_start_us = g_render_stats.timing() ? micros() : 0;
+  PageRenderData data = BuildPageData(def.id, state, display_cfg, snap, now_ms);
+  if (g_render_stats.timing()) {
+    g_render_stats.record(screen_index, RenderStats::kBuild, micros() - build_start_us);
+  }
 #ifdef DEBUG_STALE_OLED2
   static bool was_stale[kMaxZones] = {false, false, false};
   const bool is_stale = data.has_error && (strcmp(data.err_a, "STAL") == 0);
@@ -234,7 +333,7 @@ void renderScreen(AppState& state, OledU8g2& oled_primary,
     if (PageToSignal(def.id, sig)) {
 #if CORE_DEBUG_LEVEL >= 3
       if (kEnableVerboseSerialLogs) {
-        const SignalRead r = store.get(sig, now_ms);
+        const SignalRead r = snap.get(sig);
         LOGI(
             "[STALE] start t=%lu scr=%u page=%u sig=%u valid=%d age=%lu flags=0x%02X val=%.3f last_can=%lu\n",
             static_cast<unsigned long>(now_ms),
@@ -272,7 +371,8 @@ void renderScreen(AppState& state, OledU8g2& oled_primary,
   const bool heartbeat = (rs.last_draw_ms == 0) ||
                          (now_ms - rs.last_draw_ms) >= 200;
   if (!allow_refresh && !heartbeat && !state.force_redraw[screen_index]) {
-    return;
+    g_render_stats.countSkipInterval(screen_index);
+    return ZoneFrame::kNone;
   }
   const bool can_bus_error =
       AppConfig::IsRealCanEnabled() && !state.demo_mode &&
@@ -284,6 +384,8 @@ void renderScreen(AppState& state, OledU8g2& oled_primary,
        state.can_link.health == CanHealth::kStale);
   if (can_bus_error && !in_menu) {
     const char* reason = CanOverlayReason(state, now_ms);
+    const ZoneTimer timer = StartZoneTimer(disp_obj);
+    if (base_layer) disp_obj.restoreBuffer(base_layer);
     if (clear_buffer || !shared_viewport) {
       disp_obj.simpleClear();
     }
@@ -298,9 +400,13 @@ void renderScreen(AppState& state, OledU8g2& oled_primary,
       state.last_oled_ms[screen_index] = now_ms;
       rs.last_draw_ms = now_ms;
     }
-    return;
+    FinishZoneTimer(timer, disp_obj, screen_index);
+    ForgetZoneFrames(state, oled_primary, oled_secondary, disp_obj);
+    return ZoneFrame::kDrawn;
   }
   if (state.ui_menu.isActive() && screen_index == state.focus_screen) {
+    const ZoneTimer timer = StartZoneTimer(disp_obj);
+    if (base_layer) disp_obj.restoreBuffer(base_layer);
     state.ui_menu.render(
         screenDisplay(state, oled_primary, oled_secondary, screen_index),
         DisplayConfigForZone(state, static_cast<uint8_t>(screen_index)),
@@ -314,7 +420,9 @@ void renderScreen(AppState& state, OledU8g2& oled_primary,
       state.last_oled_ms[screen_index] = now_ms;
       rs.last_draw_ms = now_ms;
     }
-    return;
+    FinishZoneTimer(timer, disp_obj, screen_index);
+    ForgetZoneFrames(state, oled_primary, oled_secondary, disp_obj);
+    return ZoneFrame::kDrawn;
   }
 
   float sample_value = 0.0f;
@@ -431,11 +539,6 @@ void renderScreen(AppState& state, OledU8g2& oled_primary,
   const char* unit_str = data.unit;
 
   const uint8_t edit_phase = editing ? static_cast<uint8_t>((now_ms / 250U) & 0x1U) : 0;
-  const bool max_blink_active =
-      now_ms < state.max_blink_until_ms[screen_index] &&
-      page == state.max_blink_page[screen_index];
-  const uint8_t maxblink_phase =
-      max_blink_active ? static_cast<uint8_t>((now_ms / 120U) & 0x1U) : 0;
   const bool exclam_blink_on = ((now_ms / 250U) % 2U) == 0U;
   const bool changed =
       state.force_redraw[screen_index] || (rs.last_page != page) ||
@@ -469,12 +572,52 @@ void renderScreen(AppState& state, OledU8g2& oled_primary,
         suffix_for_render = suffix_buf;
       }
     }
+    const bool focused = screen_index == state.focus_screen;
+    const bool xor_invert = shared_viewport ? invert_on : false;
+    const bool invert_zone = (topo_large ? invert_on : false) != (flash_on && shared_viewport);
+    Fingerprint fp;
+    fp.add(def.label);
+    fp.add(value_for_render);
+    fp.add(suffix_for_render);
+    fp.add(unit_for_render);
+    fp.add(max_buf);
+    fp.add(static_cast<uint32_t>(data.valid) | (focused << 1) | (warn_marker << 2) |
+           (crit_marker << 3) | (crit << 4) | (xor_invert << 5) | (invert_zone << 6) |
+           (lock_toast << 7) |
+           (static_cast<uint32_t>(state.lock_toast_type[screen_index]) << 8) |
+           (static_cast<uint32_t>(viewport_y) << 16) |
+           (static_cast<uint32_t>(viewport_h) << 24));
+    const uint32_t fingerprint = fp.value();
+    const bool own_frame = clear_buffer && send_buffer;
+    auto remember = [&]() {
+      rs.last_page = page;
+      rs.last_value = sample_value;
+      rs.last_valid = data.valid;
+      rs.last_draw_ms = now_ms;
+      rs.last_blink_phase = edit_phase;
+      rs.last_maxblink_phase = maxblink_phase;
+      rs.last_focused = focused;
+      rs.last_exclam_phase = exclam_blink_on;
+      rs.last_lock_toast = lock_toast;
+      state.last_oled_ms[screen_index] = now_ms;
+    };
+    if (!state.force_redraw[screen_index] && fingerprint == rs.last_fingerprint &&
+        rs.last_epoch == disp_obj.frameEpoch()) {
+      // Identical to the frame on the panel: no draw, no transfer.
+      remember();
+      g_render_stats.countSkipUnchanged(screen_index);
+      if (own_frame) disp_obj.noteSkippedFrame();
+      return ZoneFrame::kUnchanged;
+    }
+    const ZoneTimer timer = StartZoneTimer(disp_obj);
+    if (clear_buffer) {
+      ForgetZoneFrames(state, oled_primary, oled_secondary, disp_obj);
+    } else if (base_layer) {
+      disp_obj.restoreBuffer(base_layer);
+    }
     disp_obj.renderMetric(def.label, value_for_render, suffix_for_render, unit_for_render, max_buf,
-                          data.valid, screen_index == state.focus_screen,
-                          warn_marker, crit_marker,
-                          crit, viewport_y, viewport_h, clear_buffer, send_buffer,
-                          shared_viewport ? invert_on : false,
-                          topo_large ? invert_on : false);
+                          data.valid, focused, warn_marker, crit_marker, crit, viewport_y,
+                          viewport_h, clear_buffer, send_buffer, xor_invert, invert_zone);
     if (lock_toast) {
       disp_obj.simpleSetFontSmall();
       const char* msg = "LOCK";
@@ -493,18 +636,19 @@ void renderScreen(AppState& state, OledU8g2& oled_primary,
       }
       disp_obj.simpleDrawStr(0, static_cast<uint8_t>(viewport_y + 12), msg);
     }
-    rs.last_page = page;
-    rs.last_value = sample_value;
-    rs.last_valid = data.valid;
-    rs.last_draw_ms = now_ms;
-    rs.last_blink_phase = edit_phase;
-    rs.last_maxblink_phase = maxblink_phase;
-    rs.last_focused = (screen_index == state.focus_screen);
-    rs.last_exclam_phase = exclam_blink_on;
-    rs.last_lock_toast = lock_toast;
+    remember();
+    rs.last_fingerprint = fingerprint;
+    if (send_buffer) MarkZoneFramesSent(state, oled_primary, oled_secondary, disp_obj);
     state.force_redraw[screen_index] = false;
-    state.last_oled_ms[screen_index] = now_ms;
+    FinishZoneTimer(timer, disp_obj, screen_index);
+    return ZoneFrame::kDrawn;
+  }
+  if (changed) {
+    g_render_stats.countSkipInterval(screen_index);
+  } else {
+    g_render_stats.countSkipUnchanged(screen_index);
   }
+  return ZoneFrame::kNone;
 }
 
 void renderUi(AppState& state, const DataStore& store,
@@ -515,6 +659,7 @@ void renderUi(AppState& state, const DataStore& store,
   if (state.sleep) {
     return;
   }
+  g_render_stats.tick(now_ms);
 
   if (state.wifi_mode_active) {
     if (state.oled_primary_ready) {
@@ -546,7 +691,10 @@ void renderUi(AppState& state, const DataStore& store,
         }
       }
       if (allow_oled1) {
+        // Counted as zone 0 so the portal sees the frames it is served with.
+        const ZoneTimer timer = StartZoneTimer(oled_primary);
         oled_primary.drawLines(line1, line2, nullptr, nullptr);
+        FinishZoneTimer(timer, oled_primary, 0);
       }
     }
     if (state.oled_secondary_ready && !s_was_wifi) {
@@ -589,6 +737,9 @@ void renderUi(AppState& state, const DataStore& store,
   }
 
   const DisplayTopology topo = state.display_topology;
+  // One coherent read of every signal per render tick; all zones share it.
+  SignalSnapshot snap;
+  store.snapshot(kAllSignalsMask, snap, now_ms);
 
   if ((topo == DisplayTopology::kLargeOnly ||
        topo == DisplayTopology::kLargePlusSmall) &&
@@ -606,13 +757,25 @@ void renderUi(AppState& state, const DataStore& store,
 #endif
       last_large_log_ms = now_ms;
     }
-    // Render zones 0/1 on primary (128x64), send once.
-    renderScreen(state, oled_primary, oled_secondary, store, alerts, 0, now_ms,
-                 allow_oled1, 0, 32, true, false);
-    renderScreen(state, oled_primary, oled_secondary, store, alerts, 1, now_ms,
-                 allow_oled1, 32, 32, false, true);
+    // Render zones 0/1 on primary (128x64), send once. The top zone clears
+    // the buffer (its big digits may reach into the bottom half), so the
+    // bottom zone always draws over a fresh top and sends; when only the
+    // bottom zone changed it starts from the saved top layer.
+    const ZoneFrame top = renderScreen(state, oled_primary, oled_secondary, snap, alerts, 0,
+                                       now_ms, allow_oled1, 0, 32, true, false);
+    if (top == ZoneFrame::kDrawn) {
+      oled_primary.saveBuffer(g_top_layer);
+      g_top_layer_valid = true;
+      state.force_redraw[1] = true;
+    }
+    const uint8_t* base = (top != ZoneFrame::kDrawn && g_top_layer_valid) ? g_top_layer : nullptr;
+    const ZoneFrame bottom = renderScreen(state, oled_primary, oled_secondary, snap, alerts, 1,
+                                          now_ms, allow_oled1, 32, 32, false, true, base);
+    if (top == ZoneFrame::kUnchanged && bottom == ZoneFrame::kUnchanged) {
+      oled_primary.noteSkippedFrame();
+    }
     if (topo == DisplayTopology::kLargePlusSmall && state.oled_secondary_ready) {
-      renderScreen(state, oled_primary, oled_secondary, store, alerts, 2, now_ms,
+      renderScreen(state, oled_primary, oled_secondary, snap, alerts, 2, now_ms,
                    allow_oled2);
     }
     return;
@@ -620,11 +783,11 @@ void renderUi(AppState& state, const DataStore& store,
 
   if (topo == DisplayTopology::kDualSmall) {
     if (state.oled_primary_ready) {
-      renderScreen(state, oled_primary, oled_secondary, store, alerts, 0,
+      renderScreen(state, oled_primary, oled_secondary, snap, alerts, 0,
                    now_ms, allow_oled1);
     }
     if (state.oled_secondary_ready) {
-      renderScreen(state, oled_primary, oled_secondary, store, alerts, 2,
+      renderScreen(state, oled_primary, oled_secondary, snap, alerts, 2,
                    now_ms, allow_oled2);
     }
     return;
@@ -634,10 +797,10 @@ void renderUi(AppState& state, const DataStore& store,
   if (state.oled_primary_ready) {
     const bool restrict_top =
         topo == DisplayTopology::kSmallOnly && oled_primary.height() > 32;
-    renderScreen(state, oled_primary, oled_secondary, store, alerts, 0, now_ms,
+    renderScreen(state, oled_primary, oled_secondary, snap, alerts, 0, now_ms,
                  allow_oled1, 0, restrict_top ? 32 : 0, true, true);
   } else if (state.oled_secondary_ready) {
-    renderScreen(state, oled_primary, oled_secondary, store, alerts, 0, now_ms,
+    renderScreen(state, oled_primary, oled_secondary, snap, alerts, 0, now_ms,
                  allow_oled2);
   }
 }
@@ -5,9 +5,12 @@
 #include "drivers/oled_u8g2.h"
 #include "data/datastore.h"
 #include "ui/pages.h"
+#include "ui/render_stats.h"
 
 void resetMaxForFocusPage(AppState& state, uint32_t now_ms);
 void renderUi(AppState& state, const DataStore& store,
               OledU8g2& oled_primary, OledU8g2& oled_secondary,
               uint32_t now_ms, bool allow_oled1, bool allow_oled2,
               const AlertsEngine& alerts);
+// Render pipeline counters of the zones drawn by renderUi (UI loop only).
+RenderStats& UiRenderStats();
@@ -6,6 +6,12 @@ SignalId sourceToSignal(UserSensorSource src) {
   switch (src) {
     case UserSensorSource::kSensor2:
       return SignalId::kSensors2;
+    case UserSensorSource::kDerived1:
+      return SignalId::kDerived1;
+    case UserSensorSource::kDerived2:
+      return SignalId::kDerived2;
+    case UserSensorSource::kDerived3:
+      return SignalId::kDerived3;
     case UserSensorSource::kSensor1:
     default:
       return SignalId::kSensors1;
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Encoding of OLED frame buffers for the /live mirror: PackBits run-length
+// coding (a header byte h < 128 is followed by h + 1 literal bytes; h >= 129
+// repeats the next byte 257 - h times), sent as base64 text. Both stream
+// through `emit` one byte / character at a time, so no output buffer is held.
+
+// Returns the number of bytes emitted (at most n + n / 128 + 1).
+template <typename Emit>
+size_t PackBitsEncode(const uint8_t* in, size_t n, Emit emit) {
+  constexpr size_t kMaxRun = 128;
+  size_t out = 0;
+  size_t i = 0;
+  auto run_at = [&](size_t at) -> size_t {
+    size_t run = 1;
+    while (at + run < n && run < kMaxRun && in[at + run] == in[at]) ++run;
+    return run;
+  };
+  while (i < n) {
+    const size_t run = run_at(i);
+    if (run >= 3) {
+      emit(static_cast<uint8_t>(257 - run));
+      emit(in[i]);
+      out += 2;
+      i += run;
+      continue;
+    }
+    // Literal up to the next run of three or more.
+    size_t len = 0;
+    while (i + len < n && len < kMaxRun && (len == 0 || run_at(i + len) < 3)) ++len;
+    emit(static_cast<uint8_t>(len - 1));
+    for (size_t k = 0; k < len; ++k) emit(in[i + k]);
+    out += len + 1;
+    i += len;
+  }
+  return out;
+}
+
+// Byte-at-a-time base64 (RFC 4648, padded); call finish() after the last
+// byte.
+template <typename EmitChar>
+class Base64Stream {
+ public:
+  explicit Base64Stream(EmitChar emit) : emit_(emit) {}
+
+  void put(uint8_t b) {
+    acc_ = (acc_ << 8) | b;
+    if (++count_ < 3) return;
+    emitQuad(4);
+    acc_ = 0;
+    count_ = 0;
+  }
+  void finish() {
+    if (count_ == 0) return;
+    const uint8_t have = count_;
+    for (; count_ < 3; ++count_) acc_ <<= 8;
+    emitQuad(static_cast<uint8_t>(have + 1));
+    acc_ = 0;
+    count_ = 0;
+  }
+
+ private:
+  void emitQuad(uint8_t chars) {
+    static const char kAlphabet[] =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    for (uint8_t k = 0; k < 4; ++k) {
+      emit_(k < chars ? kAlphabet[(acc_ >> (18 - 6 * k)) & 0x3F] : '=');
+    }
+  }
+
+  EmitChar emit_;
+  uint32_t acc_ = 0;
+  uint8_t count_ = 0;
+};
+
+template <typename EmitChar>
+Base64Stream<EmitChar> MakeBase64Stream(EmitChar emit) {
+  return Base64Stream<EmitChar>(emit);
+}
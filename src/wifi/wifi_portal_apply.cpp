@@ -157,8 +157,7 @@ void handleApply() {
   // page_count/page_mask are based on table index order, not PageId.
   size_t page_count = 0;
   GetPageTable(page_count);
-  const uint32_t page_mask =
-      (page_count >= 32) ? 0xFFFFFFFFu : ((1u << page_count) - 1);
+  const PageMask page_mask = PageMask::All(static_cast<uint8_t>(page_count));
 
   long topo_val = 0;
   if (!parseIntArg(server, "display_topology", topo_val)) {
@@ -215,7 +214,8 @@ void handleApply() {
     return static_cast<UserSensorPreset>(v);
   };
   auto clampSource = [](long v) -> UserSensorSource {
-    return (v == 1) ? UserSensorSource::kSensor2 : UserSensorSource::kSensor1;
+    if (v < 0 || v > static_cast<long>(UserSensorSource::kDerived3)) v = 0;
+    return static_cast<UserSensorSource>(v);
   };
   UserSensorCfg us_cfg[2] = {g_state.user_sensor[0], g_state.user_sensor[1]};
   auto parseUserSensor = [&](uint8_t idx) -> bool {
@@ -226,8 +226,7 @@ void handleApply() {
       us_cfg[idx].preset = clampPreset(preset_v);
       us_cfg[idx].kind = presetToKind(us_cfg[idx].preset);
     }
-    long src_v =
-        static_cast<long>(us_cfg[idx].source == UserSensorSource::kSensor2 ? 1 : 0);
+    long src_v = static_cast<long>(us_cfg[idx].source);
     snprintf(key, sizeof(key), "us%u_src", static_cast<unsigned>(idx));
     if (parseIntArg(server, key, src_v)) {
       us_cfg[idx].source = clampSource(src_v);
@@ -303,6 +302,29 @@ void handleApply() {
     if (stoich > 25.0f) stoich = 25.0f;
   }
   const bool afr_show_lambda = parseCheckboxArg(server, "afr_show_lambda");
+  SignalFilterCfg filters[kSignalCount];
+  for (size_t i = 0; i < kSignalCount; ++i) {
+    filters[i] = g_state.signal_filter[i];
+  }
+  ParseSignalFilters(server, filters);
+  DerivedChannelCfg derived[kDerivedChannelCount];
+  for (uint8_t i = 0; i < kDerivedChannelCount; ++i) {
+    derived[i] = g_state.derived[i];
+  }
+  {
+    uint8_t bad = 0;
+    const char* why = nullptr;
+    if (!ParseDerivedChannels(server, derived, bad, why)) {
+      LOGW("[APPLY] invalid: drv%u (%s)\r\n", static_cast<unsigned>(bad),
+           why ? why : "?");
+      String msg = "Derived channel DRV";
+      msg += String(static_cast<unsigned>(bad + 1));
+      msg += ": ";
+      msg += why ? why : "invalid expression";
+      sendErrorHtml(server, 400, "Apply error", msg);
+      return;
+    }
+  }
 
   String key;
   key.reserve(32);
@@ -361,9 +383,9 @@ void handleApply() {
   String ecu = server.arg("ecu_type");
   ecu.trim();
   // Rebuild masks from per-page fields
-  uint32_t units_mask = 0;
-  uint32_t alert_max_mask = 0;
-  uint32_t alert_min_mask = 0;
+  PageMask units_mask;
+  PageMask alert_max_mask;
+  PageMask alert_min_mask;
   for (size_t i = 0; i < page_count; ++i) {
     bool imperial = false;
     char key[16];
@@ -373,25 +395,25 @@ void handleApply() {
       long v = arg.toInt();
       imperial = (v != 0);
     }
-    if (imperial) units_mask |= (1U << i);
+    if (imperial) units_mask.set(static_cast<uint8_t>(i));
     snprintf(key, sizeof(key), "amax_%u", static_cast<unsigned>(i));
     if (server.hasArg(key)) {
       arg = server.arg(key);
-      if (arg != "0") alert_max_mask |= (1U << i);
+      if (arg != "0") alert_max_mask.set(static_cast<uint8_t>(i));
     }
     snprintf(key, sizeof(key), "amin_%u", static_cast<unsigned>(i));
     if (server.hasArg(key)) {
       arg = server.arg(key);
-      if (arg != "0") alert_min_mask |= (1U << i);
+      if (arg != "0") alert_min_mask.set(static_cast<uint8_t>(i));
     }
   }
-  uint32_t hidden_mask = 0;
+  PageMask hidden_mask;
   for (size_t i = 0; i < page_count; ++i) {
     char key[16];
     snprintf(key, sizeof(key), "hide_%u", static_cast<unsigned>(i));
     if (server.hasArg(key)) {
       arg = server.arg(key);
-      if (arg.length() > 0) hidden_mask |= static_cast<uint32_t>(1U << i);
+      if (arg.length() > 0) hidden_mask.set(static_cast<uint8_t>(i));
     }
   }
   if (hidden_mask == page_mask) {
@@ -411,7 +433,7 @@ void handleApply() {
         (i < page_count) ? FindPageMeta(GetPageTable(page_count)[i].id) : nullptr;
     const ValueKind kind = meta ? meta->kind : ValueKind::kNone;
     ScreenSettings cfg{};
-    cfg.imperial_units = (units_mask & (1U << i)) != 0;
+    cfg.imperial_units = units_mask.test(static_cast<uint8_t>(i));
     cfg.flip_180 = false;
     ThresholdGrid grid{};
     const bool has_grid = (i < page_count)
@@ -490,9 +512,9 @@ void handleApply() {
     new_thresholds[i].max = new_max;
   }
 
-  const uint32_t new_units_mask = units_mask & page_mask;
-  const uint32_t new_alert_max_mask = alert_max_mask & page_mask;
-  const uint32_t new_alert_min_mask = alert_min_mask & page_mask;
+  const PageMask new_units_mask = units_mask & page_mask;
+  const PageMask new_alert_max_mask = alert_max_mask & page_mask;
+  const PageMask new_alert_min_mask = alert_min_mask & page_mask;
 
   ApplyCommitData commit{};
   commit.topo = topo;
@@ -501,6 +523,12 @@ void handleApply() {
   commit.oil_swap = oil_swap_checkbox;
   commit.user_sensor[0] = us_cfg[0];
   commit.user_sensor[1] = us_cfg[1];
+  for (size_t i = 0; i < kSignalCount; ++i) {
+    commit.signal_filter[i] = filters[i];
+  }
+  for (uint8_t i = 0; i < kDerivedChannelCount; ++i) {
+    commit.derived[i] = derived[i];
+  }
   commit.stoich_afr = stoich;
   commit.afr_show_lambda = afr_show_lambda;
   commit.demo_mode = demo_mode;
@@ -16,6 +16,7 @@ void HandleApplyResetExtrema(WebServer& server, uint32_t& form_nonce) {
   }
   resetAllMax(g_state, millis());
   portEXIT_CRITICAL(&g_state_mux);
+  ResetSignalExtrema(true, true);
   form_nonce = static_cast<uint32_t>(millis() ^ random(0xFFFFFFFF));
   server.send(200, "text/html",
               "<html><body><h1>OK</h1><p>Extrema cleared.</p></body></html>");
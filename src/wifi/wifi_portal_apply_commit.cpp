@@ -31,6 +31,12 @@ bool ApplyCommitAndPersist(const ApplyCommitData& data,
   g_state.screen_cfg[1].flip_180 = data.flip1;
   g_state.user_sensor[0] = us_cfg[0];
   g_state.user_sensor[1] = us_cfg[1];
+  for (size_t i = 0; i < kSignalCount; ++i) {
+    g_state.signal_filter[i] = data.signal_filter[i];
+  }
+  for (uint8_t i = 0; i < kDerivedChannelCount; ++i) {
+    g_state.derived[i] = data.derived[i];
+  }
   g_state.stoich_afr = data.stoich_afr;
   g_state.afr_show_lambda = data.afr_show_lambda;
   strlcpy(g_state.oil_cfg.pressure_label, g_state.user_sensor[0].label,
@@ -82,6 +88,8 @@ bool ApplyCommitAndPersist(const ApplyCommitData& data,
   memcpy(g_state.thresholds, data.thresholds, sizeof(data.thresholds));
   EnsureVisiblePages(g_state);
   portEXIT_CRITICAL(&g_state_mux);
+  ApplySignalFilters();
+  ApplyDerivedChannels();
 
   UiPersist ui = BuildUiPersistFromState(g_state);
   ui.display_topology = static_cast<uint8_t>(data.topo);
@@ -97,10 +105,14 @@ bool ApplyCommitAndPersist(const ApplyCommitData& data,
   }
   bool ok = true;
   if (!g_nvs.saveUserSensors(g_state.user_sensor, g_state.stoich_afr,
-                             g_state.afr_show_lambda)) {
+                             g_state.afr_show_lambda, g_state.signal_filter)) {
     LOGE("NVS saveUserSensors failed\r\n");
     ok = false;
   }
+  if (!g_nvs.saveDerivedChannels(g_state.derived)) {
+    LOGE("NVS saveDerivedChannels failed\r\n");
+    ok = false;
+  }
   CanSettings can_cfg{};
   can_cfg.bitrate_locked = data.can_bitrate_locked;
   can_cfg.bitrate_value = data.can_bitrate_value;
@@ -14,6 +14,8 @@ struct ApplyCommitData {
   bool flip1 = false;
   bool oil_swap = false;
   UserSensorCfg user_sensor[2] = {};
+  SignalFilterCfg signal_filter[kSignalCount] = {};
+  DerivedChannelCfg derived[kDerivedChannelCount] = {};
   float stoich_afr = 14.7f;
   bool afr_show_lambda = false;
   bool demo_mode = false;
@@ -26,10 +28,10 @@ struct ApplyCommitData {
   bool can_bitrate_locked = false;
   bool can_ready = false;
   uint8_t id_present_mask = 0;
-  uint32_t page_units_mask = 0;
-  uint32_t page_alert_max_mask = 0;
-  uint32_t page_alert_min_mask = 0;
-  uint32_t page_hidden_mask = 0;
+  PageMask page_units_mask;
+  PageMask page_alert_max_mask;
+  PageMask page_alert_min_mask;
+  PageMask page_hidden_mask;
   Thresholds thresholds[kPageCount] = {};
 };
 
@@ -39,6 +41,13 @@ bool parseIntArg(WebServer& server, const char* name, long& out);
 bool parseCheckboxArg(WebServer& server, const char* name);
 bool parseFloatArg(WebServer& server, const char* name, float& out);
 bool validatePageIndex(long v, size_t page_count);
+// Lenient: out-of-range kinds/params are clamped rather than rejected.
+void ParseSignalFilters(WebServer& server, SignalFilterCfg (&filters)[kSignalCount]);
+// Strict: false (with `bad_channel`/`err` set) when an expression is too long
+// or does not compile.
+bool ParseDerivedChannels(WebServer& server,
+                          DerivedChannelCfg (&derived)[kDerivedChannelCount],
+                          uint8_t& bad_channel, const char*& err);
 
 bool ParseBootPages(WebServer& server, size_t page_count,
                     uint8_t (&boot_pages_internal)[kMaxZones],
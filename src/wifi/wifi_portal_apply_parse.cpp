@@ -47,3 +47,56 @@ bool parseFloatArg(WebServer& server, const char* name, float& out) {
 bool validatePageIndex(long v, size_t page_count) {
   return v >= 0 && static_cast<size_t>(v) < page_count;
 }
+
+const SignalId kFilterFieldSignals[kFilterFieldCount] = {
+    SignalId::kMap,
+    SignalId::kAfr1,
+    SignalId::kSensors1,
+    SignalId::kSensors2,
+    SignalId::kBatt,
+    SignalId::kEgt1,
+};
+
+void ParseSignalFilters(WebServer& server, SignalFilterCfg (&filters)[kSignalCount]) {
+  char key[16];
+  for (size_t i = 0; i < kFilterFieldCount; ++i) {
+    const unsigned id = static_cast<unsigned>(kFilterFieldSignals[i]);
+    SignalFilterCfg cfg = filters[id];
+    long kind_v = static_cast<long>(cfg.kind);
+    snprintf(key, sizeof(key), "flt%u_k", id);
+    if (parseIntArg(server, key, kind_v)) {
+      cfg.kind = (kind_v < 0 || kind_v >= static_cast<long>(FilterKind::kCount))
+                     ? FilterKind::kNone
+                     : static_cast<FilterKind>(kind_v);
+    }
+    long param_v = static_cast<long>(cfg.param);
+    snprintf(key, sizeof(key), "flt%u_p", id);
+    if (parseIntArg(server, key, param_v)) {
+      if (param_v < 0) param_v = 0;
+      if (param_v > 60000) param_v = 60000;
+      cfg.param = static_cast<uint16_t>(param_v);
+    }
+    filters[id] = SanitizeFilterCfg(cfg);
+  }
+}
+
+bool ParseDerivedChannels(WebServer& server,
+                          DerivedChannelCfg (&derived)[kDerivedChannelCount],
+                          uint8_t& bad_channel, const char*& err) {
+  char key[8];
+  for (uint8_t k = 0; k < kDerivedChannelCount; ++k) {
+    snprintf(key, sizeof(key), "drv%u", static_cast<unsigned>(k));
+    if (!server.hasArg(key)) continue;
+    String expr = server.arg(key);
+    expr.trim();
+    if (expr.length() >= kDerivedExprLen || !isPrintableAscii(expr)) {
+      bad_channel = k;
+      err = "too long or not printable";
+      return false;
+    }
+    strlcpy(derived[k].expr, expr.c_str(), sizeof(derived[k].expr));
+  }
+  // Compile-check the whole table (channels may reference each other).
+  DerivedChannels probe;
+  return probe.configure(derived, kDerivedChannelCount, &bad_channel, &err);
+}
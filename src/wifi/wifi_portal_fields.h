@@ -3,3 +3,7 @@
 #include "app_state.h"
 
 extern const char* const kFieldBootPage[kMaxZones];
+
+// Signals offered in the "Signal Smoothing" table (fields flt<id>_k/_p).
+constexpr size_t kFilterFieldCount = 6;
+extern const SignalId kFilterFieldSignals[kFilterFieldCount];
@@ -4,6 +4,7 @@ void handleRoot();
 void handleRedirect();
 void handleReportCsv();
 void handleConfigJson();
+void handleSignalHealthJson();
 void handleApply();
 void handleLivePage();
 void handleLiveEvents();
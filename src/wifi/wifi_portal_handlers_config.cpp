@@ -13,6 +13,8 @@
 #include "boot/boot_strings.h"
 #include "config/factory_config.h"
 #include "config/logging.h"
+#include "data/signal_contract.h"
+#include "data/signal_filter.h"
 #include "ecu/ecu_manager.h"
 #include "settings/ui_persist_build.h"
 #include "ui/pages.h"
@@ -161,7 +163,14 @@ void handleRoot() {
     if (us.source == UserSensorSource::kSensor1) send(" selected");
     send(">Sensor1</option><option value='1'");
     if (us.source == UserSensorSource::kSensor2) send(" selected");
-    send(">Sensor2</option></select></td><td>");
+    send(">Sensor2</option>");
+    for (uint8_t k = 0; k < kDerivedChannelCount; ++k) {
+      const uint8_t v = static_cast<uint8_t>(UserSensorSource::kDerived1) + k;
+      send.SendFmt("<option value='%u'%s>DRV%u</option>", static_cast<unsigned>(v),
+                   (static_cast<uint8_t>(us.source) == v) ? " selected" : "",
+                   static_cast<unsigned>(k + 1));
+    }
+    send("</select></td><td>");
     send("<input type='text' name='us");
     send.SendFmt("%u", static_cast<unsigned int>(idx));
     send("_lbl' value='");
@@ -188,6 +197,45 @@ void handleRoot() {
   renderUsRow(0, ui.user_sensor[0]);
   renderUsRow(1, ui.user_sensor[1]);
   send("</table></div>");
+  send("<h3>Signal Smoothing</h3>");
+  send("<p style='margin:4px 0 8px 0;'>Applied once per CAN sample. EMA: time constant (ms). "
+       "Rate limit: max change per second (signal units).</p>");
+  send("<div class='table-wrap'><table class='wide'>");
+  send("<tr><th>Signal</th><th>Filter</th><th>Param</th></tr>");
+  for (size_t i = 0; i < kFilterFieldCount; ++i) {
+    const SignalId id = kFilterFieldSignals[i];
+    const unsigned idx = static_cast<unsigned>(id);
+    const SignalFilterCfg& cfg = ui.signal_filter[idx];
+    const SignalContractEntry* ent = LookupSignalContract(id);
+    send("<tr><td>");
+    SendHtmlEscaped(send, ent ? ent->name : "?");
+    send.SendFmt("</td><td><select name='flt%u_k'>", idx);
+    for (uint8_t k = 0; k < static_cast<uint8_t>(FilterKind::kCount); ++k) {
+      send.SendFmt("<option value='%u'%s>", static_cast<unsigned>(k),
+                   (k == static_cast<uint8_t>(cfg.kind)) ? " selected" : "");
+      send(FilterKindName(static_cast<FilterKind>(k)));
+      send("</option>");
+    }
+    send.SendFmt("</select></td><td><input type='number' name='flt%u_p' min='0' "
+                 "max='60000' value='%u'></td></tr>",
+                 idx, static_cast<unsigned>(cfg.param));
+  }
+  send("</table></div>");
+  send("<h3>Derived Channels</h3>");
+  send("<p style='margin:4px 0 8px 0;'>Computed when an input changes; show one by picking "
+       "DRV1-3 as a user sensor source. Signal names (e.g. PW1, RPM, AFR1, AFRtg1), "
+       "numbers, + - * / and parentheses; a channel may use lower-numbered DRVs. "
+       "Empty = off.</p>");
+  send("<div class='table-wrap'><table class='wide'>");
+  send("<tr><th>Channel</th><th>Expression</th></tr>");
+  for (uint8_t k = 0; k < kDerivedChannelCount; ++k) {
+    send.SendFmt("<tr><td>DRV%u</td><td><input type='text' name='drv%u' value='",
+                 static_cast<unsigned>(k + 1), static_cast<unsigned>(k));
+    SendHtmlEscaped(send, ui.derived[k].expr);
+    send.SendFmt("' maxlength='%u'></td></tr>",
+                 static_cast<unsigned>(kDerivedExprLen - 1));
+  }
+  send("</table></div>");
   send("<h3>AFR / Lambda</h3>");
   send.SendFmt("<div class='check-row'><label>Stoich AFR</label>"
                "<input type='number' name='stoich_afr' step='0.1' min='10' max='25' value='%.1f'></div>",
@@ -484,6 +532,7 @@ void handleResetExtrema() {
   }
   resetAllMax(g_state, millis());
   portEXIT_CRITICAL(&g_state_mux);
+  ResetSignalExtrema(true, true);
   handleRedirect();
 }
 
@@ -519,6 +568,7 @@ void handleResetMinOnly() {
     g_state.page_recorded_min[i] = NAN;
   }
   portEXIT_CRITICAL(&g_state_mux);
+  ResetSignalExtrema(true, false);
   form_nonce = static_cast<uint32_t>(millis() ^ random(0xFFFFFFFF));
   handleRedirect();
 }
@@ -6,9 +6,12 @@
 
 #include "app/app_globals.h"
 #include "app/app_ui_snapshot.h"
+#include "app/warm_start.h"
 #include "app_state.h"
 #include "config/factory_config.h"
 #include "config/logging.h"
+#include "data/signal_contract.h"
+#include "data/signal_health.h"
 #include "ui/pages.h"
 #include "wifi/wifi_diag.h"
 #include "wifi/wifi_portal_escape.h"
@@ -112,7 +115,7 @@ void handleReportCsv() {
     const ValueKind kind = meta ? meta->kind : ValueKind::kNone;
     ScreenSettings cfg{};
     cfg.imperial_units =
-        (ui.page_units_mask & (1U << static_cast<uint8_t>(i))) != 0;
+        ui.page_units_mask.test(static_cast<uint8_t>(i));
     cfg.flip_180 = false;
     const char* units = unitsForKind(kind, cfg.imperial_units);
     const float rec_min = ui.page_recorded_min[i];
@@ -120,9 +123,9 @@ void handleReportCsv() {
     const float thr_min = ui.thresholds[i].min;
     const float thr_max = ui.thresholds[i].max;
     const bool alert_max =
-        (ui.page_alert_max_mask & (1U << static_cast<uint8_t>(i))) != 0;
+        ui.page_alert_max_mask.test(static_cast<uint8_t>(i));
     const bool alert_min =
-        (ui.page_alert_min_mask & (1U << static_cast<uint8_t>(i))) != 0;
+        ui.page_alert_min_mask.test(static_cast<uint8_t>(i));
     const char* label = (meta && meta->label) ? meta->label : "PAGE";
     char label_csv[96];
     char units_csv[32];
@@ -201,7 +204,7 @@ void handleConfigJson() {
     const PageMeta* meta = FindPageMeta(pages[i].id);
     ScreenSettings cfg{};
     cfg.imperial_units =
-        (ui.page_units_mask & (1U << static_cast<uint8_t>(i))) != 0;
+        ui.page_units_mask.test(static_cast<uint8_t>(i));
     cfg.flip_180 = false;
     const ValueKind kind = meta ? meta->kind : ValueKind::kNone;
     auto appendVal = [&](float v) {
@@ -217,9 +220,9 @@ void handleConfigJson() {
       appendFloat(static_cast<double>(disp), one_dec ? 1 : 0);
     };
     const bool alert_max =
-        (ui.page_alert_max_mask & (1U << static_cast<uint8_t>(i))) != 0;
+        ui.page_alert_max_mask.test(static_cast<uint8_t>(i));
     const bool alert_min =
-        (ui.page_alert_min_mask & (1U << static_cast<uint8_t>(i))) != 0;
+        ui.page_alert_min_mask.test(static_cast<uint8_t>(i));
     if (i > 0) send.SendRaw(",");
     send.SendRaw("{");
     send.SendRaw("\"index\":");
@@ -283,6 +286,31 @@ void handleConfigJson() {
     send.SendRaw("}");
   }
   send.SendRaw("],");
+  send.SendRaw("\"signal_filters\":[");
+  bool first_filter = true;
+  for (size_t i = 0; i < kSignalCount; ++i) {
+    const SignalFilterCfg& f = ui.signal_filter[i];
+    if (f.kind == FilterKind::kNone) continue;
+    const SignalContractEntry* ent = LookupSignalContract(static_cast<SignalId>(i));
+    if (!first_filter) send.SendRaw(",");
+    first_filter = false;
+    send.SendRaw("{\"signal\":\"");
+    SendJsonEscaped(send, ent ? ent->name : "?");
+    send.SendRaw("\",\"kind\":");
+    appendUInt(static_cast<uint8_t>(f.kind));
+    send.SendRaw(",\"param\":");
+    appendUInt(f.param);
+    send.SendRaw("}");
+  }
+  send.SendRaw("],");
+  send.SendRaw("\"derived_channels\":[");
+  for (uint8_t i = 0; i < kDerivedChannelCount; ++i) {
+    if (i) send.SendRaw(",");
+    send.SendRaw("\"");
+    SendJsonEscaped(send, ui.derived[i].expr);
+    send.SendRaw("\"");
+  }
+  send.SendRaw("],");
   send.SendRaw("\"stoich_afr\":");
   appendFloat(static_cast<double>(ui.stoich_afr), 1);
   send.SendRaw(",");
@@ -293,6 +321,55 @@ void handleConfigJson() {
   server.sendContent("");
 }
 
+void handleSignalHealthJson() {
+  WebServer& server = WifiPortalServer();
+  WifiDiagIncHttp();
+  constexpr size_t kCount = static_cast<size_t>(SignalId::kCount);
+  static SignalHealthStats health[kCount];
+  const uint32_t now_ms = millis();
+  const bool have = g_datastore_can.readHealth(health, kCount, now_ms);
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.sendHeader("Cache-Control", "no-store");
+  server.send(200, "application/json", "");
+  SendFn send(server);
+  uint32_t total_updates = 0;
+  uint32_t total_suppressed = 0;
+  for (size_t i = 0; have && i < kCount; ++i) {
+    total_updates += health[i].updates;
+    total_suppressed += health[i].suppressed;
+  }
+  send.SendRaw("{\"schema\":\"signal_health_v1\",");
+  send.SendFmt("\"warm_start\":%s,\"first_live_ms\":%lu,",
+               WarmStartWasWarm() ? "true" : "false",
+               static_cast<unsigned long>(WarmStartFirstLiveMs()));
+  send.SendFmt("\"suppressed_pct\":%.1f,\"signals\":[",
+               total_updates ? 100.0 * total_suppressed / total_updates : 0.0);
+  for (size_t i = 0; have && i < kCount; ++i) {
+    const SignalHealthStats& h = health[i];
+    const SignalContractEntry* ent = LookupSignalContract(static_cast<SignalId>(i));
+    if (i > 0) send.SendRaw(",");
+    send.SendRaw("{\"name\":\"");
+    SendJsonEscaped(send, ent ? ent->name : "?");
+    send.SendFmt("\",\"updates\":%lu,\"suppressed\":%lu,\"hz\":%.1f,\"rejects\":%lu,"
+                 "\"invalid_ms\":%lu,\"stale_events\":%u,",
+                 static_cast<unsigned long>(h.updates),
+                 static_cast<unsigned long>(h.suppressed), static_cast<double>(h.rate_hz),
+                 static_cast<unsigned long>(h.rejects),
+                 static_cast<unsigned long>(h.invalid_ms),
+                 static_cast<unsigned>(h.stale_events));
+    if (h.last_ms == 0 || !isfinite(h.last_raw)) {
+      send.SendRaw("\"last_raw\":null,\"age_ms\":null}");
+    } else {
+      send.SendFmt("\"last_raw\":%.3f,\"age_ms\":%lu}",
+                   static_cast<double>(h.last_raw),
+                   static_cast<unsigned long>(now_ms - h.last_ms));
+    }
+  }
+  send.SendRaw("]}");
+  send.Flush();
+  server.sendContent("");
+}
+
 void handleLivePage() {
   WebServer& server = WifiPortalServer();
   WifiDiagIncHttp();
@@ -316,9 +393,12 @@ void handleLivePage() {
        "th,td{border:1px solid #d8dbe2;padding:8px 10px;text-align:left;vertical-align:middle;}"
        "th{background:#f0f1f4;}"
        ".status{font-size:0.95rem;color:#555;margin-bottom:8px;}"
+       "canvas{display:none;width:100%;background:#000;border-radius:6px;margin-bottom:8px;"
+       "image-rendering:pixelated;}"
        "</style></head><body><div class='card'>");
   send("<h1>Live Data</h1>");
   send("<div class='status'>Status: <span id='live_status'>Disconnected</span></div>");
+  send("<canvas id='oled0'></canvas><canvas id='oled1'></canvas>");
   send("<table><thead><tr><th>#</th><th>Label</th><th>Value</th><th>Unit</th></tr></thead><tbody>");
   for (size_t i = 0; i < page_count; ++i) {
     const PageMeta* meta = FindPageMeta(pages[i].id);
@@ -342,7 +422,7 @@ void handleLivePage() {
   send("</div><script>"
        "const statusEl=document.getElementById('live_status');"
        "function setStatus(s){statusEl.textContent=s;}"
-       "const es=new EventSource('/live/events');"
+       "const es=new EventSource('/live/events?oled=1');"
        "es.onmessage=function(ev){"
        " try{const data=JSON.parse(ev.data);"
        "  const arr=Array.isArray(data)?data:(data.items||[]);"
@@ -361,6 +441,24 @@ void handleLivePage() {
        " }catch(e){setStatus('Parse error');}"
        "};"
        "es.onerror=function(){setStatus('Disconnected');};"
+       // OLED mirror: PackBits-decode the page-major frame, then plot it
+       // (LSB = top row; hardware invert and 180 degree flip applied).
+       "es.addEventListener('oled',function(ev){"
+       " try{const m=JSON.parse(ev.data);const c=document.getElementById('oled'+m.d);"
+       "  if(!c)return;const s=atob(m.rle);const f=new Uint8Array(m.w*m.h/8);"
+       "  let i=0,o=0;"
+       "  while(i<s.length&&o<f.length){const h=s.charCodeAt(i++);"
+       "   if(h<128){for(let k=0;k<=h;k++)f[o++]=s.charCodeAt(i++);}"
+       "   else if(h>128){const b=s.charCodeAt(i++);for(let k=0;k<257-h;k++)f[o++]=b;}}"
+       "  c.width=m.w;c.height=m.h;c.style.display='block';"
+       "  const ctx=c.getContext('2d');const img=ctx.createImageData(m.w,m.h);"
+       "  for(let y=0;y<m.h;y++)for(let x=0;x<m.w;x++){"
+       "   const on=((f[(y>>3)*m.w+x]>>(y&7))&1)^m.inv;"
+       "   const p=((m.flip?m.h-1-y:y)*m.w+(m.flip?m.w-1-x:x))*4;"
+       "   img.data[p]=img.data[p+1]=img.data[p+2]=on?255:0;img.data[p+3]=255;}"
+       "  ctx.putImageData(img,0,0);"
+       " }catch(e){}"
+       "});"
        "</script></body></html>");
   send.Flush();
   server.sendContent("");
@@ -124,6 +124,10 @@ void WifiPortalHttpRegisterRoutes(WebServer& server) {
     LogHttp(server);
     handleConfigJson();
   });
+  server.on("/signals.json", HTTP_GET, [&server]() {
+    LogHttp(server);
+    handleSignalHealthJson();
+  });
   server.on("/fw", HTTP_GET, [&server]() {
     LogHttp(server);
     handleFirmwarePage();
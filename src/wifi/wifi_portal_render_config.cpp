@@ -71,17 +71,17 @@ const char* topoToStr(DisplayTopology t) {
 void renderPerPageRow(const SendFn& send, size_t index, const PageDef* pages,
                       const PageMeta* meta, const AppUiSnapshot& ui) {
   const bool imperial =
-      (ui.page_units_mask & (1U << static_cast<uint8_t>(index))) != 0;
+      ui.page_units_mask.test(static_cast<uint8_t>(index));
   const ValueKind kind = meta ? meta->kind : ValueKind::kNone;
   ScreenSettings cfg{};
   cfg.imperial_units = imperial;
   cfg.flip_180 = false;
   const bool amax =
-      (ui.page_alert_max_mask & (1U << static_cast<uint8_t>(index))) != 0;
+      ui.page_alert_max_mask.test(static_cast<uint8_t>(index));
   const bool amin =
-      (ui.page_alert_min_mask & (1U << static_cast<uint8_t>(index))) != 0;
+      ui.page_alert_min_mask.test(static_cast<uint8_t>(index));
   const bool hidden =
-      (ui.page_hidden_mask & (1U << static_cast<uint8_t>(index))) != 0;
+      ui.page_hidden_mask.test(static_cast<uint8_t>(index));
   const UnitOption uo = unitOptionsForMeta(meta);
   // Stream output to avoid large per-row String allocations in portal render.
   char idx_buf[16];
@@ -184,6 +184,7 @@ void renderDownloads(const SendFn& send) {
   send("<h2>Downloads</h2><ul>");
   send("<li><a href='/download/report.csv'>report.csv</a></li>");
   send("<li><a href='/download/config.json'>config.json</a></li>");
+  send("<li><a href='/signals.json'>signals.json</a> (CAN signal health)</li>");
   send("</ul>");
 }
 
@@ -342,7 +343,7 @@ void renderRecordedExtrema(const SendFn& send, size_t page_count,
     const ValueKind kind = meta ? meta->kind : ValueKind::kNone;
     ScreenSettings cfg{};
     cfg.imperial_units =
-        (ui.page_units_mask & (1U << static_cast<uint8_t>(i))) != 0;
+        ui.page_units_mask.test(static_cast<uint8_t>(i));
     cfg.flip_180 = false;
     const char* units = unitsForKind(kind, cfg.imperial_units);
     const float rec_min = ui.page_recorded_min[i];
@@ -365,9 +366,9 @@ void renderRecordedExtrema(const SendFn& send, size_t page_count,
       return out;
     };
     const bool alert_max =
-        (ui.page_alert_max_mask & (1U << static_cast<uint8_t>(i))) != 0;
+        ui.page_alert_max_mask.test(static_cast<uint8_t>(i));
     const bool alert_min =
-        (ui.page_alert_min_mask & (1U << static_cast<uint8_t>(i))) != 0;
+        ui.page_alert_min_mask.test(static_cast<uint8_t>(i));
     char buf[24];
     char idx_buf[16];
     snprintf(idx_buf, sizeof(idx_buf), "%u", static_cast<unsigned>(i));
@@ -8,8 +8,12 @@
 
 #include "app/app_globals.h"
 #include "app/app_ui_snapshot.h"
+#include "app/display_task.h"
 #include "config/factory_config.h"
+#include "drivers/oled_u8g2.h"
 #include "ui/pages.h"
+#include "ui_render.h"
+#include "wifi/oled_mirror_codec.h"
 #include "wifi/wifi_portal_escape.h"
 
 namespace {
@@ -18,6 +22,12 @@ WiFiClient sse_client;
 bool sse_active = false;
 uint32_t sse_last_send_ms = 0;
 uint32_t sse_frames_sent = 0;
+uint32_t sse_frames_skipped = 0;
+int8_t sse_sub_can = -1;
+int8_t sse_sub_demo = -1;
+// Frames still go out this often with no signal change: ages, stale marks
+// and CAN counters move without writes.
+constexpr uint32_t kSseKeepaliveMs = 1000;
 
 struct SseWriter {
   static constexpr size_t kBufSize = 1024;
@@ -65,8 +75,52 @@ struct SseWriter {
   size_t len_ = 0;
 };
 
+// OLED mirror (/live/events?oled=1): each panel's frame as last written,
+// PackBits + base64 in an "oled" event, sent only after it changed. One
+// static frame copy serves both displays.
+constexpr uint32_t kMirrorIntervalMs = 250;
+constexpr uint8_t kMirrorUnsent = 0xFF;
+bool sse_mirror = false;
+uint32_t mirror_last_ms = 0;
+uint32_t mirror_seq[2] = {};
+uint8_t mirror_flags[2] = {kMirrorUnsent, kMirrorUnsent};  // inverted | flipped << 1
+uint8_t mirror_frame[OledU8g2::kFrameBytes];
+
+void SendOledMirror(uint32_t now_ms) {
+  if (!sse_mirror || (now_ms - mirror_last_ms) < kMirrorIntervalMs) return;
+  mirror_last_ms = now_ms;
+  OledU8g2* const displays[2] = {&g_oled_primary, &g_oled_secondary};
+  for (uint8_t d = 0; d < 2; ++d) {
+    OledU8g2& oled = *displays[d];
+    const uint8_t flags =
+        static_cast<uint8_t>((oled.inverted() ? 1 : 0) | (oled.flipped() ? 2 : 0));
+    const uint32_t seq = oled.shownSeq();
+    if (mirror_flags[d] == flags && mirror_seq[d] == seq) continue;
+    uint8_t tiles_w = 0;
+    uint8_t tiles_h = 0;
+    if (!oled.copyShownFrame(mirror_frame, tiles_w, tiles_h)) continue;
+    SseWriter out(sse_client);
+    out.SendFmt("event: oled\ndata: {\"d\":%u,\"w\":%u,\"h\":%u,\"inv\":%u,\"flip\":%u,\"rle\":\"",
+                static_cast<unsigned>(d), static_cast<unsigned>(tiles_w * 8),
+                static_cast<unsigned>(tiles_h * 8), static_cast<unsigned>(flags & 1),
+                static_cast<unsigned>(flags >> 1));
+    auto b64 = MakeBase64Stream([&out](char c) { out.SendChar(c); });
+    PackBitsEncode(mirror_frame, static_cast<size_t>(tiles_w) * tiles_h * 8,
+                   [&b64](uint8_t b) { b64.put(b); });
+    b64.finish();
+    out.SendRaw("\"}\n\n");
+    mirror_seq[d] = seq;
+    mirror_flags[d] = flags;
+  }
+}
+
 }  // namespace
 
+void WifiPortalSseInit() {
+  sse_sub_can = g_datastore_can.subscribe(kAllSignalsMask);
+  sse_sub_demo = g_datastore_demo.subscribe(kAllSignalsMask);
+}
+
 void WifiPortalSseBegin(WebServer& server) {
   AppUiSnapshot ui;
   GetAppUiSnapshot(ui);
@@ -93,6 +147,10 @@ void WifiPortalSseBegin(WebServer& server) {
   sse_client.setNoDelay(true);
   sse_active = true;
   sse_last_send_ms = 0;
+  sse_mirror = server.hasArg("oled");
+  mirror_last_ms = 0;
+  mirror_flags[0] = kMirrorUnsent;
+  mirror_flags[1] = kMirrorUnsent;
   sse_client.print(":ok\n\n");
   sse_client.flush();
 }
@@ -104,10 +162,19 @@ void WifiPortalSseTick(uint32_t now_ms) {
     sse_active = false;
     return;
   }
+  SendOledMirror(now_ms);
   if (sse_last_send_ms != 0 &&
       (now_ms - sse_last_send_ms) < kWifiSseIntervalMs) {
     return;
   }
+  // Drain both so a demo/CAN switch starts clean; the idle store reads 0.
+  const SignalMask changed =
+      g_datastore_can.takeDirty(sse_sub_can) | g_datastore_demo.takeDirty(sse_sub_demo);
+  if (changed == 0 && sse_last_send_ms != 0 &&
+      (now_ms - sse_last_send_ms) < kSseKeepaliveMs) {
+    ++sse_frames_skipped;
+    return;
+  }
 
   AppUiSnapshot ui;
   GetAppUiSnapshot(ui);
@@ -138,7 +205,58 @@ void WifiPortalSseTick(uint32_t now_ms) {
   out.SendFmt("%lu", static_cast<unsigned long>(stats_snapshot.rx_total));
   out.SendRaw(",\"rx_dash\":");
   out.SendFmt("%lu", static_cast<unsigned long>(stats_snapshot.rx_dash));
-  const SignalRead map_r = ActiveStore().get(SignalId::kMap, now_ms);
+  out.SendRaw(",\"decode_repeat\":");
+  out.SendFmt("%lu", static_cast<unsigned long>(stats_snapshot.decode_repeat));
+  out.SendRaw(",\"frames_skipped\":");
+  out.SendFmt("%lu", static_cast<unsigned long>(sse_frames_skipped));
+  // Mean OLED bus bytes per frame (tile-diff partial updates).
+  const OledU8g2::FrameStats& oled1 = g_oled_primary.frameStats();
+  const OledU8g2::FrameStats& oled2 = g_oled_secondary.frameStats();
+  out.SendFmt(",\"oled_bytes\":[%lu,%lu]",
+              static_cast<unsigned long>(oled1.frames ? oled1.bytes_total / oled1.frames : 0),
+              static_cast<unsigned long>(oled2.frames ? oled2.bytes_total / oled2.frames : 0));
+  // Main-loop time blocked in frame sends per render tick (last second).
+  const DisplayBlockStats blocked = DisplayLoopBlockStats();
+  out.SendFmt(",\"oled_block_us\":[%lu,%lu]", static_cast<unsigned long>(blocked.avg_us),
+              static_cast<unsigned long>(blocked.max_us));
+  // Scheduled frame interval and mean transfer time per display.
+  const DisplayRateStats rate1 = DisplayRate(false);
+  const DisplayRateStats rate2 = DisplayRate(true);
+  out.SendFmt(",\"oled_interval_ms\":[%lu,%lu]", static_cast<unsigned long>(rate1.interval_ms),
+              static_cast<unsigned long>(rate2.interval_ms));
+  out.SendFmt(",\"oled_tx_us\":[%lu,%lu]", static_cast<unsigned long>(rate1.transfer_us),
+              static_cast<unsigned long>(rate2.transfer_us));
+  // Bit-banged OLED2 bus throughput per clock it ran at: [[hz, bytes/s], ...].
+  uint8_t sw_clock_count = 0;
+  const SwI2c::ClockStats* sw_clocks = g_oled_secondary.swBus().clockStats(sw_clock_count);
+  out.SendRaw(",\"oled2_sw_bps\":[");
+  for (uint8_t i = 0; i < sw_clock_count; ++i) {
+    out.SendFmt("%s[%lu,%lu]", i ? "," : "", static_cast<unsigned long>(sw_clocks[i].hz),
+                static_cast<unsigned long>(sw_clocks[i].bytesPerSec()));
+  }
+  out.SendRaw("]");
+  // Render pipeline per zone over the last complete window: [min,avg,max] us
+  // per stage, frames drawn, skipped by interval / unchanged.
+  static const char* const kStageKeys[RenderStats::kStageCount] = {"build", "draw", "send"};
+  RenderStats& render = UiRenderStats();
+  out.SendFmt(",\"render_window_ms\":%lu,\"render\":[",
+              static_cast<unsigned long>(render.windowMs()));
+  for (uint8_t z = 0; z < RenderStats::kZones; ++z) {
+    const RenderStats::Zone& zs = render.zone(z, now_ms);
+    out.SendFmt("%s{", z ? "," : "");
+    for (uint8_t st = 0; st < RenderStats::kStageCount; ++st) {
+      const RenderStats::Timing& t = zs.stage[st];
+      out.SendFmt("\"%s\":[%lu,%lu,%lu],", kStageKeys[st], static_cast<unsigned long>(t.min_us),
+                  static_cast<unsigned long>(t.avgUs()), static_cast<unsigned long>(t.max_us));
+    }
+    out.SendFmt("\"frames\":%u,\"skip_interval\":%u,\"skip_unchanged\":%u}",
+                static_cast<unsigned>(zs.frames), static_cast<unsigned>(zs.skipped_interval),
+                static_cast<unsigned>(zs.skipped_unchanged));
+  }
+  out.SendRaw("]");
+  SignalSnapshot snap;
+  ActiveStore().snapshot(kAllSignalsMask, snap, now_ms);
+  const SignalRead map_r = snap.get(SignalId::kMap);
   out.SendRaw(",\"map_age_ms\":");
   out.SendFmt("%lu", static_cast<unsigned long>(map_r.age_ms));
   out.SendRaw(",\"map_flags\":");
@@ -150,10 +268,10 @@ void WifiPortalSseTick(uint32_t now_ms) {
   for (size_t i = 0; i < page_count; ++i) {
     ScreenSettings cfg{};
     cfg.imperial_units =
-        (ui.page_units_mask & (1U << static_cast<uint8_t>(i))) != 0;
+        ui.page_units_mask.test(static_cast<uint8_t>(i));
     cfg.flip_180 = false;
     const PageRenderData d =
-        BuildPageData(pages[i].id, page_state, cfg, ActiveStore(), now_ms);
+        BuildPageData(pages[i].id, page_state, cfg, snap, now_ms);
     const PageMeta* meta = FindPageMeta(pages[i].id);
     const char* label = (meta && meta->label) ? meta->label : "PAGE";
     const char* unit = (d.unit) ? d.unit : "";
@@ -4,6 +4,9 @@
 
 class WebServer;
 
+// Boot-time: change subscriptions on both stores, so frames are only built
+// when a signal moved (or at the keepalive interval).
+void WifiPortalSseInit();
 void WifiPortalSseBegin(WebServer& server);
 void WifiPortalSseTick(uint32_t now_ms);
 void WifiPortalSseStop();
@@ -1,5 +1,7 @@
 #include <unity.h>
 #include "data/datastore.h"
+#include "data/signal_filter.h"
+#include "data/signal_health.h"
 
 void test_seq_even_after_update() {
   DataStore ds;
@@ -32,10 +34,202 @@ void test_get_consistency() {
   TEST_ASSERT_TRUE((r.flags & kFlagInvalid) == 0);
 }
 
+void test_group_update_single_bump() {
+  DataStore ds;
+#ifdef UNIT_TEST
+  const uint32_t before = ds.debug_seq(SignalId::kMap);
+#endif
+  const SignalSample batch[3] = {{SignalId::kRpm, 900.0f},
+                                 {SignalId::kMap, 101.0f},
+                                 {SignalId::kClt, 500.0f}};
+  ds.updateGroup(batch, 3, 1000, 0x4U);
+#ifdef UNIT_TEST
+  TEST_ASSERT_EQUAL_UINT32_MESSAGE(before + 2, ds.debug_seq(SignalId::kMap),
+                                   "one sequence bump per group");
+#endif
+
+  SignalSnapshot snap;
+  ds.snapshot(SignalBit(SignalId::kRpm) | SignalBit(SignalId::kClt), snap, 1100);
+  TEST_ASSERT_TRUE(snap.get(SignalId::kRpm).valid);
+  TEST_ASSERT_EQUAL_FLOAT(900.0f, snap.get(SignalId::kRpm).value);
+  TEST_ASSERT_TRUE((snap.get(SignalId::kClt).flags & kFlagInvalid) != 0);
+  TEST_ASSERT_FALSE(snap.get(SignalId::kMap).valid);  // outside mask
+
+  ds.snapshot(kAllSignalsMask, snap, 1100);
+  TEST_ASSERT_EQUAL_FLOAT(101.0f, snap.get(SignalId::kMap).value);
+}
+
+static int g_notify_calls = 0;
+static void CountNotify(void*) { ++g_notify_calls; }
+
+void test_subscription_dirty_and_notify() {
+  DataStore ds;
+  g_notify_calls = 0;
+  const int8_t sub = ds.subscribe(SignalBit(SignalId::kRpm), CountNotify);
+  TEST_ASSERT_TRUE(sub >= 0);
+
+  ds.update(SignalId::kMap, 100.0f, 1000);  // not subscribed
+  TEST_ASSERT_EQUAL_INT(0, g_notify_calls);
+  ds.update(SignalId::kRpm, 900.0f, 1000);
+  ds.update(SignalId::kRpm, 950.0f, 1010);
+  TEST_ASSERT_EQUAL_INT_MESSAGE(1, g_notify_calls, "notify on clean->dirty only");
+  TEST_ASSERT_EQUAL_UINT32(SignalBit(SignalId::kRpm), ds.takeDirty(sub));
+  TEST_ASSERT_EQUAL_UINT32(0, ds.takeDirty(sub));
+
+  ds.setSubscriptionMask(sub, SignalBit(SignalId::kMap));
+  const SignalSample batch[2] = {{SignalId::kRpm, 1000.0f}, {SignalId::kMap, 99.0f}};
+  ds.updateGroup(batch, 2, 1020);
+  TEST_ASSERT_EQUAL_INT(2, g_notify_calls);
+  TEST_ASSERT_EQUAL_UINT32(SignalBit(SignalId::kMap), ds.takeDirty(sub));
+}
+
+void test_health_counts_rejects_and_holds() {
+  DataStore ds;
+  SignalHealth health;
+  ds.attachHealth(&health);
+  const SignalSample ok[1] = {{SignalId::kMap, 100.0f}};
+  const SignalSample bad[1] = {{SignalId::kMap, 999.0f}};
+  ds.updateGroup(ok, 1, 1000);
+  ds.updateGroup(bad, 1, 1020, 0x1U, 1500);
+  ds.updateGroup(ok, 1, 1400);  // good sample cuts the hold after 380 ms
+  ds.updateGroup(ok, 1, 3000);  // gap > 500 ms stale window
+
+  SignalHealthStats out[static_cast<size_t>(SignalId::kCount)];
+  TEST_ASSERT_TRUE(ds.readHealth(out, static_cast<size_t>(SignalId::kCount), 3000));
+  const SignalHealthStats& h = out[static_cast<size_t>(SignalId::kMap)];
+  TEST_ASSERT_EQUAL_UINT32(3, h.updates);
+  TEST_ASSERT_EQUAL_UINT32(1, h.rejects);
+  TEST_ASSERT_EQUAL_UINT32(380, h.invalid_ms);
+  TEST_ASSERT_EQUAL_UINT32(1, h.stale_events);
+  TEST_ASSERT_EQUAL_FLOAT(100.0f, h.last_raw);
+  TEST_ASSERT_EQUAL_UINT32(0, out[static_cast<size_t>(SignalId::kRpm)].updates);
+}
+
+void test_deadband_refreshes_without_change() {
+  DataStore ds;
+  SignalHealth health;
+  ds.attachHealth(&health);
+  const int8_t sub = ds.subscribe(SignalBit(SignalId::kClt) | SignalBit(SignalId::kMap));
+  ds.update(SignalId::kClt, 180.0f, 1000);
+  TEST_ASSERT_EQUAL_UINT32(SignalBit(SignalId::kClt), ds.takeDirty(sub));
+
+  // One LSB of jitter: value held, freshness refreshed, no change bit.
+  ds.update(SignalId::kClt, 180.1f, 1400);
+  TEST_ASSERT_EQUAL_UINT32(0, ds.takeDirty(sub));
+  SignalRead r = ds.get(SignalId::kClt, 1800);
+  TEST_ASSERT_EQUAL_FLOAT(180.0f, r.value);
+  TEST_ASSERT_EQUAL_UINT32(400, r.age_ms);
+  ds.update(SignalId::kClt, 180.3f, 1500);
+  TEST_ASSERT_EQUAL_UINT32(SignalBit(SignalId::kClt), ds.takeDirty(sub));
+
+  // Exact repeats are suppressed on every channel unless disabled.
+  const SignalSample map[1] = {{SignalId::kMap, 100.0f}};
+  ds.updateGroup(map, 1, 1500);
+  ds.updateGroup(map, 1, 1510);
+  TEST_ASSERT_EQUAL_UINT32(SignalBit(SignalId::kMap), ds.takeDirty(sub));
+  ds.setDeadband(SignalId::kMap, -1.0f);
+  ds.updateGroup(map, 1, 1520);
+  TEST_ASSERT_EQUAL_UINT32(SignalBit(SignalId::kMap), ds.takeDirty(sub));
+
+  // A repeat after the stale window is a visible change (stale -> fresh).
+  ds.update(SignalId::kClt, 180.3f, 2500);
+  TEST_ASSERT_EQUAL_UINT32(SignalBit(SignalId::kClt), ds.takeDirty(sub));
+
+  SignalHealthStats out[static_cast<size_t>(SignalId::kCount)];
+  TEST_ASSERT_TRUE(ds.readHealth(out, static_cast<size_t>(SignalId::kCount), 2500));
+  TEST_ASSERT_EQUAL_UINT32(4, out[static_cast<size_t>(SignalId::kClt)].updates);
+  TEST_ASSERT_EQUAL_UINT32(1, out[static_cast<size_t>(SignalId::kClt)].suppressed);
+  TEST_ASSERT_EQUAL_UINT32(1, out[static_cast<size_t>(SignalId::kMap)].suppressed);
+}
+
+void test_filtered_value_converges_under_steady_input() {
+  DataStore ds;
+  SignalFilters filters;
+  ds.attachFilters(&filters);
+  SignalFilterCfg cfg[static_cast<size_t>(SignalId::kCount)];
+  cfg[static_cast<size_t>(SignalId::kMap)].kind = FilterKind::kMedian3;
+  cfg[static_cast<size_t>(SignalId::kClt)].kind = FilterKind::kEma;
+  cfg[static_cast<size_t>(SignalId::kClt)].param = 500;
+  filters.configure(cfg, static_cast<size_t>(SignalId::kCount));
+
+  // Step, then hold: repeats of the new input must keep feeding the filter.
+  const SignalSample high[] = {{SignalId::kMap, 100.0f}, {SignalId::kClt, 100.0f}};
+  const SignalSample low[] = {{SignalId::kMap, 50.0f}, {SignalId::kClt, 50.0f}};
+  uint32_t now = 1000;
+  for (int i = 0; i < 3; ++i, now += 50) ds.updateGroup(high, 2, now);
+  for (int i = 0; i < 200; ++i, now += 50) ds.updateGroup(low, 2, now);
+
+  SignalRead r = ds.get(SignalId::kMap, now);
+  TEST_ASSERT_EQUAL_FLOAT(50.0f, r.raw);
+  TEST_ASSERT_EQUAL_FLOAT(50.0f, r.value);
+  r = ds.get(SignalId::kClt, now);
+  TEST_ASSERT_EQUAL_FLOAT(50.0f, r.raw);
+  TEST_ASSERT_FLOAT_WITHIN(0.05f, 50.0f, r.value);
+}
+
+// Non-dyadic inputs never round-trip through the filters' Q8 state exactly;
+// once a filter stops moving, repeats must still hit the deadband.
+void test_settled_filter_engages_deadband() {
+  DataStore ds;
+  SignalFilters filters;
+  ds.attachFilters(&filters);
+  SignalFilterCfg cfg[static_cast<size_t>(SignalId::kCount)];
+  cfg[static_cast<size_t>(SignalId::kMap)].kind = FilterKind::kMedian3;
+  cfg[static_cast<size_t>(SignalId::kClt)].kind = FilterKind::kEma;
+  cfg[static_cast<size_t>(SignalId::kClt)].param = 500;
+  filters.configure(cfg, static_cast<size_t>(SignalId::kCount));
+  const int8_t sub = ds.subscribe(kAllSignalsMask);
+
+  const SignalSample steady[] = {{SignalId::kMap, 101.3f}, {SignalId::kClt, 87.3f}};
+  uint32_t now = 1000;
+  ds.updateGroup(steady, 2, now);
+  TEST_ASSERT_TRUE(ds.get(SignalId::kClt, now).value != 87.3f);  // Q8 rounding
+  for (int i = 0; i < 50; ++i) ds.updateGroup(steady, 2, now += 50);
+  ds.takeDirty(sub);
+  ds.updateGroup(steady, 2, now += 50);
+  TEST_ASSERT_EQUAL_UINT32(0, ds.takeDirty(sub));
+  TEST_ASSERT_EQUAL_UINT32(0, ds.get(SignalId::kClt, now).age_ms);
+
+  // A reconfigure is fed again even on a repeated input.
+  cfg[static_cast<size_t>(SignalId::kClt)].param = 1000;
+  filters.configure(cfg, static_cast<size_t>(SignalId::kCount));
+  ds.updateGroup(steady, 2, now += 50);
+  TEST_ASSERT_TRUE((ds.takeDirty(sub) & SignalBit(SignalId::kClt)) != 0);
+}
+
+void test_restored_values_read_stale_until_live() {
+  DataStore ds;
+  const int8_t sub = ds.subscribe(kAllSignalsMask);
+  const SignalSample retained[] = {{SignalId::kClt, 190.0f}, {SignalId::kRpm, 850.0f}};
+  ds.restore(retained, 2, 10);
+  TEST_ASSERT_EQUAL_UINT32(SignalBit(SignalId::kClt) | SignalBit(SignalId::kRpm),
+                           ds.takeDirty(sub));
+  SignalRead r = ds.get(SignalId::kClt, 20);
+  TEST_ASSERT_FALSE(r.valid);
+  TEST_ASSERT_TRUE((r.flags & kFlagStale) != 0);
+  TEST_ASSERT_TRUE((r.flags & kFlagRetained) != 0);
+  TEST_ASSERT_EQUAL_FLOAT(190.0f, r.value);
+
+  // The first live sample clears the mark, even when it repeats the value.
+  ds.update(SignalId::kClt, 190.0f, 30);
+  r = ds.get(SignalId::kClt, 40);
+  TEST_ASSERT_TRUE(r.valid);
+  TEST_ASSERT_EQUAL_UINT8(0, r.flags);
+  TEST_ASSERT_EQUAL_UINT32(SignalBit(SignalId::kClt), ds.takeDirty(sub));
+  TEST_ASSERT_FALSE(ds.get(SignalId::kRpm, 40).valid);
+}
+
 int main() {
   UNITY_BEGIN();
   RUN_TEST(test_seq_even_after_update);
   RUN_TEST(test_seq_even_after_invalid);
   RUN_TEST(test_get_consistency);
+  RUN_TEST(test_group_update_single_bump);
+  RUN_TEST(test_subscription_dirty_and_notify);
+  RUN_TEST(test_health_counts_rejects_and_holds);
+  RUN_TEST(test_deadband_refreshes_without_change);
+  RUN_TEST(test_filtered_value_converges_under_steady_input);
+  RUN_TEST(test_settled_filter_engages_deadband);
+  RUN_TEST(test_restored_values_read_stale_until_live);
   return UNITY_END();
 }
@@ -0,0 +1,140 @@
+#include <unity.h>
+
+#include <string.h>
+
+#include "ecu/decode_cache.h"
+#include "ms3_decode/ms3_decode.h"
+
+namespace {
+
+twai_message_t Frame(uint32_t id, uint8_t b0, uint8_t b1) {
+  twai_message_t msg{};
+  msg.identifier = id;
+  msg.data_length_code = 8;
+  msg.data[0] = b0;
+  msg.data[1] = b1;
+  return msg;
+}
+
+const DecodeCache::Entry* Find(DecodeCache& cache, const twai_message_t& msg) {
+  return cache.find(msg.identifier, msg.extd, msg.data_length_code, msg.data);
+}
+
+void Store(DecodeCache& cache, const twai_message_t& msg, float value) {
+  const SignalSample batch[] = {{SignalId::kRpm, value}};
+  cache.store(msg.identifier, msg.extd, msg.data_length_code, msg.data, batch, 1, 0);
+}
+
+// Idle trace: all five MS3 dash IDs at 50 Hz each. RPM and PW wander by one
+// LSB every few frames, EGT every tenth; everything else holds still.
+void IdleFrame(uint32_t n, twai_message_t& msg) {
+  static constexpr uint32_t kIds[] = {0x5E8, 0x5E9, 0x5EA, 0x5EB, 0x5EC};
+  msg = twai_message_t{};
+  const uint32_t cycle = n / 5;
+  msg.identifier = kIds[n % 5];
+  msg.data_length_code = 8;
+  switch (n % 5) {
+    case 0: {  // MAP 35.0 kPa, RPM 850 +/- 1, CLT 185.0 F, TPS 0
+      const uint16_t rpm = static_cast<uint16_t>(850 + ((cycle / 4) % 3));
+      const uint8_t bytes[] = {0x01, 0x5E, static_cast<uint8_t>(rpm >> 8),
+                               static_cast<uint8_t>(rpm), 0x07, 0x3A, 0x00, 0x00};
+      memcpy(msg.data, bytes, sizeof(bytes));
+      break;
+    }
+    case 1: {  // PW1/PW2 2.100 ms +/- 1 us, MAT 95.0 F, ADV 15.0
+      const uint16_t pw = static_cast<uint16_t>(2100 + ((cycle / 5) % 2));
+      const uint8_t bytes[] = {static_cast<uint8_t>(pw >> 8), static_cast<uint8_t>(pw),
+                               0x08, 0x34, 0x03, 0xB6, 0x00, 0x96};
+      memcpy(msg.data, bytes, sizeof(bytes));
+      break;
+    }
+    case 2: {  // AFR target/actual 14.7, EGO 100.0, EGT 900.x F
+      const uint16_t egt = static_cast<uint16_t>(9000 + ((cycle / 10) % 3));
+      const uint8_t bytes[] = {0x93, 0x93, 0x03, 0xE8, static_cast<uint8_t>(egt >> 8),
+                               static_cast<uint8_t>(egt), 0x08, 0x34};
+      memcpy(msg.data, bytes, sizeof(bytes));
+      break;
+    }
+    case 3: {  // BATT 13.8 V, sensors, knock 0
+      const uint8_t bytes[] = {0x00, 0x8A, 0x01, 0xF4, 0x00, 0x64, 0x00, 0x00};
+      memcpy(msg.data, bytes, sizeof(bytes));
+      break;
+    }
+    default:  // VSS 0, TC 0, launch 0
+      break;
+  }
+}
+
+}  // namespace
+
+void test_hit_only_on_identical_payload() {
+  DecodeCache cache;
+  const twai_message_t a = Frame(0x5E8, 0x12, 0x34);
+  TEST_ASSERT_NULL(Find(cache, a));
+  Store(cache, a, 1.0f);
+  const DecodeCache::Entry* e = Find(cache, a);
+  TEST_ASSERT_NOT_NULL(e);
+  TEST_ASSERT_EQUAL_UINT8(1, e->count);
+  TEST_ASSERT_EQUAL_FLOAT(1.0f, e->batch[0].phys);
+
+  twai_message_t b = a;
+  b.data[7] = 0x01;
+  TEST_ASSERT_NULL(Find(cache, b));
+  b = a;
+  b.extd = 1;
+  TEST_ASSERT_NULL(Find(cache, b));
+  // Bytes past the DLC are not part of the payload.
+  twai_message_t shorter = Frame(0x5E9, 0x12, 0x34);
+  shorter.data_length_code = 2;
+  Store(cache, shorter, 2.0f);
+  shorter.data[5] = 0xFF;
+  TEST_ASSERT_NOT_NULL(Find(cache, shorter));
+  shorter.data_length_code = 3;
+  TEST_ASSERT_NULL(Find(cache, shorter));
+  TEST_ASSERT_EQUAL_UINT32(2, cache.hits());
+  TEST_ASSERT_EQUAL_UINT32(4, cache.misses());
+
+  // More IDs than slots evict instead of failing.
+  for (uint32_t id = 0x100; id < 0x100 + DecodeCache::kSlots + 2; ++id) {
+    Store(cache, Frame(id, 0, 0), 0.0f);
+  }
+  TEST_ASSERT_NOT_NULL(Find(cache, Frame(0x100 + DecodeCache::kSlots + 1, 0, 0)));
+  cache.clear();
+  TEST_ASSERT_NULL(Find(cache, a));
+}
+
+// Replays a recorded-style idle trace through the cache. Every replayed batch
+// must match a fresh decode, and only payload changes may miss.
+void test_idle_replay_hit_rate() {
+  constexpr uint32_t kCycles = 50 * 10;  // 10 s of idle traffic
+  constexpr uint32_t kFrames = kCycles * 5;
+  // One miss per distinct payload run: RPM changes every 4th cycle, PW every
+  // 5th, EGT every 10th; the other two IDs never change.
+  constexpr uint32_t kMisses = kCycles / 4 + kCycles / 5 + kCycles / 10 + 1 + 1;
+  const Ms3Decoder decoder;
+  DecodeCache cache;
+  twai_message_t msg;
+  SignalSample fresh[DecodeCache::kMaxSignals];
+  uint8_t count = 0;
+  for (uint32_t n = 0; n < kFrames; ++n) {
+    IdleFrame(n, msg);
+    TEST_ASSERT_TRUE(decoder.decode(msg, fresh, count));
+    const DecodeCache::Entry* hit =
+        cache.find(msg.identifier, msg.extd, msg.data_length_code, msg.data);
+    if (hit) {
+      TEST_ASSERT_EQUAL_UINT8(count, hit->count);
+      TEST_ASSERT_EQUAL_MEMORY(fresh, hit->batch, count * sizeof(SignalSample));
+    } else {
+      cache.store(msg.identifier, msg.extd, msg.data_length_code, msg.data, fresh, count, 0);
+    }
+  }
+  TEST_ASSERT_EQUAL_UINT32(kMisses, cache.misses());
+  TEST_ASSERT_EQUAL_UINT32(kFrames - kMisses, cache.hits());
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_hit_only_on_identical_payload);
+  RUN_TEST(test_idle_replay_hit_rate);
+  return UNITY_END();
+}
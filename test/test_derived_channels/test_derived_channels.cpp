@@ -0,0 +1,192 @@
+#include <unity.h>
+
+#include <string.h>
+
+#include "data/datastore.h"
+#include "data/derived_channels.h"
+#include "data/signal_contract.h"
+#include "data/signal_filter.h"
+
+namespace {
+
+bool LoadFixed(const void*, SignalId id, float& out) {
+  switch (id) {
+    case SignalId::kRpm:
+      out = 6000.0f;
+      return true;
+    case SignalId::kPw1:
+      out = 10.0f;
+      return true;
+    case SignalId::kAfr1:
+      out = 13.0f;
+      return true;
+    case SignalId::kAfrTarget1:
+      out = 12.5f;
+      return true;
+    default:
+      return false;
+  }
+}
+
+float Eval(const char* text) {
+  DerivedProgram prog;
+  TEST_ASSERT_TRUE(CompileDerivedExpr(text, prog));
+  float v = 0.0f;
+  TEST_ASSERT_TRUE(RunDerivedProgram(prog, LoadFixed, nullptr, v));
+  return v;
+}
+
+DerivedChannelCfg Cfg(const char* text) {
+  DerivedChannelCfg c;
+  strncpy(c.expr, text, sizeof(c.expr) - 1);
+  return c;
+}
+
+}  // namespace
+
+void test_compile_and_run() {
+  TEST_ASSERT_FLOAT_WITHIN(0.001f, 50.0f, Eval("PW1*RPM/1200"));
+  TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.5f, Eval("afr1 - AFRtg1"));
+  TEST_ASSERT_FLOAT_WITHIN(0.001f, -7.0f, Eval("1 + 2 * -(3 + 1)"));
+  TEST_ASSERT_FLOAT_WITHIN(0.001f, 2.5f, Eval("-(-5) / 2"));
+
+  DerivedProgram prog;
+  TEST_ASSERT_TRUE(CompileDerivedExpr("PW1*RPM/1200", prog));
+  TEST_ASSERT_EQUAL_UINT32(SignalBit(SignalId::kPw1) | SignalBit(SignalId::kRpm),
+                           prog.inputs);
+  // An input that is not available, or a zero divisor, yields no value.
+  float v = 0.0f;
+  TEST_ASSERT_TRUE(CompileDerivedExpr("MAP+1", prog));
+  TEST_ASSERT_FALSE(RunDerivedProgram(prog, LoadFixed, nullptr, v));
+  TEST_ASSERT_TRUE(CompileDerivedExpr("RPM/(PW1-10)", prog));
+  TEST_ASSERT_FALSE(RunDerivedProgram(prog, LoadFixed, nullptr, v));
+}
+
+void test_compile_errors() {
+  DerivedProgram prog;
+  const char* err = nullptr;
+  TEST_ASSERT_FALSE(CompileDerivedExpr("RPM*", prog, &err));
+  TEST_ASSERT_EQUAL_STRING("unexpected end", err);
+  TEST_ASSERT_FALSE(CompileDerivedExpr("FOO+1", prog, &err));
+  TEST_ASSERT_EQUAL_STRING("unknown signal", err);
+  TEST_ASSERT_FALSE(CompileDerivedExpr("(RPM", prog, &err));
+  TEST_ASSERT_FALSE(CompileDerivedExpr("RPM RPM", prog, &err));
+  TEST_ASSERT_FALSE(CompileDerivedExpr("1+(PW1+(2+(PW1+(3+(PW1+(4+(PW1+5)))))))", prog, &err));
+  TEST_ASSERT_EQUAL_STRING("expression too deep", err);
+  TEST_ASSERT_TRUE(CompileDerivedExpr("  ", prog));
+  TEST_ASSERT_EQUAL_UINT8(0, prog.code_len);
+
+  DerivedChannels channels;
+  const DerivedChannelCfg self[] = {Cfg("DRV1+1")};
+  uint8_t bad = 0xFF;
+  TEST_ASSERT_FALSE(channels.configure(self, 1, &bad, &err));
+  TEST_ASSERT_EQUAL_UINT8(0, bad);
+}
+
+// Corrupted bytecode is refused by the verifier and yields no value at run
+// time instead of reading or writing outside the program's arrays.
+void test_malformed_program_is_rejected() {
+  DerivedProgram good;
+  TEST_ASSERT_TRUE(CompileDerivedExpr("1+2", good));  // const 0, const 1, add
+  TEST_ASSERT_TRUE(VerifyDerivedProgram(good));
+  float v = 0.0f;
+
+  DerivedProgram bad = good;
+  bad.code_len = 1;  // operand cut off
+  TEST_ASSERT_FALSE(VerifyDerivedProgram(bad));
+  TEST_ASSERT_FALSE(RunDerivedProgram(bad, LoadFixed, nullptr, v));
+
+  bad = good;
+  bad.code[1] = 200;  // const index past consts
+  TEST_ASSERT_FALSE(VerifyDerivedProgram(bad));
+  TEST_ASSERT_FALSE(RunDerivedProgram(bad, LoadFixed, nullptr, v));
+
+  bad = good;
+  bad.code[0] = good.code[4];  // add on an empty stack
+  TEST_ASSERT_FALSE(VerifyDerivedProgram(bad));
+  TEST_ASSERT_FALSE(RunDerivedProgram(bad, LoadFixed, nullptr, v));
+
+  bad = good;
+  bad.code_len = 0;
+  for (uint8_t i = 0; i <= DerivedProgram::kMaxStack; ++i) {  // one push too many
+    bad.code[bad.code_len++] = good.code[0];
+    bad.code[bad.code_len++] = 0;
+  }
+  TEST_ASSERT_FALSE(VerifyDerivedProgram(bad));
+  TEST_ASSERT_FALSE(RunDerivedProgram(bad, LoadFixed, nullptr, v));
+
+  bad = good;
+  bad.code_len = 200;
+  TEST_ASSERT_FALSE(VerifyDerivedProgram(bad));
+  TEST_ASSERT_FALSE(RunDerivedProgram(bad, LoadFixed, nullptr, v));
+
+  TEST_ASSERT_TRUE(RunDerivedProgram(good, LoadFixed, nullptr, v));
+  TEST_ASSERT_EQUAL_FLOAT(3.0f, v);
+}
+
+void test_store_evaluates_on_input_change() {
+  DataStore ds;
+  DerivedChannels channels;
+  const DerivedChannelCfg cfg[] = {Cfg("PW1*RPM/1200"), Cfg("AFR1-AFRtg1"),
+                                   Cfg("DRV1*2")};
+  TEST_ASSERT_TRUE(channels.configure(cfg, 3));
+  ds.attachDerived(&channels);
+  const int8_t sub = ds.subscribe(kAllSignalsMask);
+
+  const SignalSample engine[] = {{SignalId::kRpm, 3000.0f}, {SignalId::kPw1, 4.0f}};
+  ds.updateGroup(engine, 2, 100);
+  SignalRead duty = ds.get(SignalId::kDerived1, 100);
+  TEST_ASSERT_TRUE(duty.valid);
+  TEST_ASSERT_FLOAT_WITHIN(0.001f, 10.0f, duty.value);
+  // Chained channel follows in the same update; AFR error has no inputs yet.
+  TEST_ASSERT_FLOAT_WITHIN(0.001f, 20.0f, ds.get(SignalId::kDerived3, 100).value);
+  TEST_ASSERT_FALSE(ds.get(SignalId::kDerived2, 100).valid);
+  TEST_ASSERT_EQUAL_UINT32(SignalBit(SignalId::kRpm) | SignalBit(SignalId::kPw1) |
+                               SignalBit(SignalId::kDerived1) |
+                               SignalBit(SignalId::kDerived3),
+                           ds.takeDirty(sub));
+
+  // Unrelated writes leave the derived values alone.
+  ds.update(SignalId::kClt, 180.0f, 200);
+  TEST_ASSERT_EQUAL_UINT32(SignalBit(SignalId::kClt), ds.takeDirty(sub));
+  TEST_ASSERT_EQUAL_UINT32(100, 200 - ds.get(SignalId::kDerived1, 200).age_ms);
+
+  ds.update(SignalId::kAfr1, 14.0f, 300);
+  TEST_ASSERT_FALSE(ds.get(SignalId::kDerived2, 300).valid);
+  ds.update(SignalId::kAfrTarget1, 14.7f, 310);
+  TEST_ASSERT_FLOAT_WITHIN(0.001f, -0.7f, ds.get(SignalId::kDerived2, 310).value);
+
+  // A stale input withholds the result instead of mixing old and new data.
+  ds.update(SignalId::kRpm, 6000.0f, 1000);
+  TEST_ASSERT_FLOAT_WITHIN(0.001f, 10.0f, ds.get(SignalId::kDerived1, 1000).value);
+}
+
+// Derived channels compute from decoded values, not from a smoothed input.
+void test_filtered_input_feeds_raw_value() {
+  DataStore ds;
+  SignalFilters filters;
+  SignalFilterCfg fcfg[kSignalCount];
+  fcfg[static_cast<size_t>(SignalId::kRpm)].kind = FilterKind::kEma;
+  fcfg[static_cast<size_t>(SignalId::kRpm)].param = 1000;
+  filters.configure(fcfg, kSignalCount);
+  DerivedChannels channels;
+  const DerivedChannelCfg cfg[] = {Cfg("RPM/2")};
+  TEST_ASSERT_TRUE(channels.configure(cfg, 1));
+  ds.attachFilters(&filters);
+  ds.attachDerived(&channels);
+
+  ds.update(SignalId::kRpm, 1000.0f, 100);
+  ds.update(SignalId::kRpm, 5000.0f, 200);
+  TEST_ASSERT_TRUE(ds.get(SignalId::kRpm, 200).value < 2000.0f);  // still smoothing
+  TEST_ASSERT_FLOAT_WITHIN(0.001f, 2500.0f, ds.get(SignalId::kDerived1, 200).value);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_compile_and_run);
+  RUN_TEST(test_compile_errors);
+  RUN_TEST(test_malformed_program_is_rejected);
+  RUN_TEST(test_store_evaluates_on_input_change);
+  RUN_TEST(test_filtered_input_feeds_raw_value);
+  return UNITY_END();
+}
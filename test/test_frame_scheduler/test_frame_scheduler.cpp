@@ -0,0 +1,109 @@
+#include <unity.h>
+
+#include "app/frame_scheduler.h"
+
+namespace {
+
+const bool kBoth[2] = {true, true};
+const bool kPrimaryOnly[2] = {true, false};
+const bool kNone[2] = {false, false};
+
+}  // namespace
+
+void test_fast_bus_runs_at_cap() {
+  FrameScheduler s;
+  s.recordTransfers(0, 10, 100000, 0);  // 10 ms per frame, all changed
+  s.update(kPrimaryOnly, kNone, 60);
+  TEST_ASSERT_EQUAL_UINT32(10000, s.rate(0).transfer_us);
+  TEST_ASSERT_EQUAL_UINT32(FrameScheduler::kMinIntervalMs, s.rate(0).interval_ms);
+  TEST_ASSERT_EQUAL_UINT8(0, s.rate(1).weight);
+}
+
+void test_slow_bus_shares_budget() {
+  FrameScheduler s;
+  s.recordTransfers(0, 2, 240000, 0);  // 120 ms per frame
+  s.recordTransfers(1, 2, 240000, 0);
+  s.update(kBoth, kNone, 60);
+  // 120 ms / (1/2 * 60%) = 400 ms each.
+  TEST_ASSERT_EQUAL_UINT32(400, s.rate(0).interval_ms);
+  TEST_ASSERT_EQUAL_UINT32(400, s.rate(1).interval_ms);
+
+  const bool urgent[2] = {true, false};
+  s.update(kBoth, urgent, 60);
+  // Weights 4:2 -> 120 ms / (2/3 * 60%) = 300 ms; the other is capped.
+  TEST_ASSERT_EQUAL_UINT32(300, s.rate(0).interval_ms);
+  TEST_ASSERT_EQUAL_UINT32(FrameScheduler::kMaxIntervalMs, s.rate(1).interval_ms);
+  TEST_ASSERT_EQUAL_UINT8(0, s.pickFirst());
+  TEST_ASSERT_EQUAL_UINT8(0, s.pickFirst());
+}
+
+void test_static_display_idles() {
+  FrameScheduler s;
+  s.recordTransfers(0, 4, 40000, 0);
+  s.recordTransfers(1, FrameScheduler::kIdleAfterFrames, 0,
+                    FrameScheduler::kIdleAfterFrames);
+  s.update(kBoth, kNone, 60);
+  TEST_ASSERT_TRUE(s.rate(0).changing);
+  TEST_ASSERT_FALSE(s.rate(1).changing);
+  TEST_ASSERT_EQUAL_UINT32(FrameScheduler::kIdleIntervalMs, s.rate(1).interval_ms);
+  TEST_ASSERT_TRUE(s.rate(0).weight > s.rate(1).weight);
+  TEST_ASSERT_EQUAL_UINT8(0, s.pickFirst());
+
+  // One changed frame makes it count as changing again.
+  s.recordTransfers(1, 1, 10000, 0);
+  TEST_ASSERT_TRUE(s.rate(1).changing);
+  s.update(kBoth, kNone, 60);
+  TEST_ASSERT_EQUAL_UINT8(s.rate(0).weight, s.rate(1).weight);
+  const uint8_t first = s.pickFirst();
+  TEST_ASSERT_EQUAL_UINT8(first ^ 1, s.pickFirst());  // tie alternates
+}
+
+void test_interval_hysteresis() {
+  FrameScheduler s;
+  s.recordTransfers(0, 1, 120000, 0);
+  s.update(kPrimaryOnly, kNone, 60);
+  TEST_ASSERT_EQUAL_UINT32(200, s.rate(0).interval_ms);
+  // ~5% faster transfers: not worth a rate change.
+  s.recordTransfers(0, 1, 96000, 0);  // EMA -> 114 ms
+  s.update(kPrimaryOnly, kNone, 60);
+  TEST_ASSERT_EQUAL_UINT32(200, s.rate(0).interval_ms);
+  // Slower transfers apply at once.
+  s.recordTransfers(0, 1, 210000, 0);  // EMA -> 138 ms
+  s.update(kPrimaryOnly, kNone, 60);
+  TEST_ASSERT_EQUAL_UINT32(230, s.rate(0).interval_ms);
+}
+
+void test_bus_clock_seed() {
+  FrameScheduler s;
+  s.setBusClock(0, 400000);
+  TEST_ASSERT_EQUAL_UINT32(11520, s.rate(0).transfer_us);
+  s.recordTransfers(0, 1, 5000, 0);
+  s.setBusClock(0, 25000);  // measured: the seed no longer applies
+  TEST_ASSERT_EQUAL_UINT32(5000, s.rate(0).transfer_us);
+}
+
+void test_unchanged_frames_stay_out_of_mean() {
+  FrameScheduler s;
+  // 4 frames went out at 10 ms each; 6 more were skipped or had no changed
+  // tiles and put nothing on the bus.
+  s.recordTransfers(0, 10, 40000, 6);
+  TEST_ASSERT_EQUAL_UINT32(10000, s.rate(0).transfer_us);
+  TEST_ASSERT_TRUE(s.rate(0).changing);
+  // A batch with nothing transferred leaves the estimate alone.
+  s.recordTransfers(0, 3, 0, 3);
+  TEST_ASSERT_EQUAL_UINT32(10000, s.rate(0).transfer_us);
+  s.update(kPrimaryOnly, kNone, 60);
+  // 10 ms / 60% = 17 ms, capped at 40 ms.
+  TEST_ASSERT_EQUAL_UINT32(FrameScheduler::kMinIntervalMs, s.rate(0).interval_ms);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_fast_bus_runs_at_cap);
+  RUN_TEST(test_slow_bus_shares_budget);
+  RUN_TEST(test_static_display_idles);
+  RUN_TEST(test_interval_hysteresis);
+  RUN_TEST(test_bus_clock_seed);
+  RUN_TEST(test_unchanged_frames_stay_out_of_mean);
+  return UNITY_END();
+}
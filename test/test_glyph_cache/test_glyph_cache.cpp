@@ -0,0 +1,270 @@
+#include <U8g2lib.h>
+#include <unity.h>
+
+#include <chrono>
+#include <stdio.h>
+#include <string.h>
+
+#include "drivers/glyph_cache.h"
+
+namespace {
+
+// Synthetic big-digit font with U8g2 draw semantics: per-glyph bbox with
+// negative offsets, ragged pixels, optional solid (background) mode.
+struct TestFont {
+  bool solid;
+};
+
+constexpr TestFont kTransparentFont{false};
+constexpr TestFont kSolidFont{true};
+
+struct GlyphShape {
+  int16_t x0, y0, w, h, advance;
+};
+
+GlyphShape ShapeFor(char ch) {
+  const int16_t i = static_cast<int16_t>(static_cast<uint8_t>(ch) % 13);
+  return GlyphShape{static_cast<int16_t>(i % 3 - 1), static_cast<int16_t>(-(30 + i % 5)),
+                    static_cast<int16_t>(12 + i % 9), static_cast<int16_t>(31 + i % 6),
+                    static_cast<int16_t>(20 + i % 4)};
+}
+
+bool GlyphPixel(char ch, int16_t r, int16_t c) {
+  const uint32_t h = (static_cast<uint32_t>(ch) * 2654435761u) ^ (r * 40503u) ^ (c * 9176u);
+  return ((h >> 7) & 3u) != 0;
+}
+
+void SetPixel(uint8_t* frame, uint8_t tiles_w, uint8_t tiles_h, int16_t x, int16_t y,
+              uint8_t color, bool flip) {
+  const int16_t width = tiles_w * 8;
+  const int16_t height = tiles_h * 8;
+  if (flip) {
+    x = static_cast<int16_t>(width - 1 - x);
+    y = static_cast<int16_t>(height - 1 - y);
+  }
+  if (x < 0 || y < 0 || x >= width || y >= height) return;
+  uint8_t& b = frame[(y / 8) * width + x];
+  const uint8_t bit = static_cast<uint8_t>(1u << (y % 8));
+  if (color == 0) {
+    b = static_cast<uint8_t>(b & ~bit);
+  } else if (color == 1) {
+    b = static_cast<uint8_t>(b | bit);
+  } else {
+    b = static_cast<uint8_t>(b ^ bit);
+  }
+}
+
+// Reference for U8g2's drawStr: foreground in the draw color, background of
+// the glyph bbox in the opposite color when the font mode is solid.
+int16_t RefDrawStr(const TestFont& font, const char* s, uint8_t* frame, uint8_t tiles_w,
+                   uint8_t tiles_h, int16_t x, int16_t y, uint8_t color, bool flip) {
+  const int16_t start = x;
+  for (const char* p = s; *p; ++p) {
+    const GlyphShape g = ShapeFor(*p);
+    for (int16_t r = 0; r < g.h; ++r) {
+      for (int16_t c = 0; c < g.w; ++c) {
+        const int16_t px = static_cast<int16_t>(x + g.x0 + c);
+        const int16_t py = static_cast<int16_t>(y + g.y0 + r);
+        if (GlyphPixel(*p, r, c)) {
+          SetPixel(frame, tiles_w, tiles_h, px, py, color, flip);
+        } else if (font.solid) {
+          SetPixel(frame, tiles_w, tiles_h, px, py, color == 0 ? 1 : 0, flip);
+        }
+      }
+    }
+    x = static_cast<int16_t>(x + g.advance);
+  }
+  return static_cast<int16_t>(x - start);
+}
+
+int16_t Raster(void*, const void* font, char ch, uint8_t color, uint8_t* canvas) {
+  const char s[2] = {ch, '\0'};
+  return RefDrawStr(*static_cast<const TestFont*>(font), s, canvas, 16,
+                    GlyphCache::kCanvasPages, GlyphCache::kOriginX, GlyphCache::kOriginY,
+                    color, false);
+}
+
+void Noise(uint8_t* frame, size_t len, uint32_t seed) {
+  for (size_t i = 0; i < len; ++i) {
+    seed = seed * 1103515245u + 12345u;
+    frame[i] = static_cast<uint8_t>(seed >> 16);
+  }
+}
+
+GlyphCache g_cache;  // ~18 KB, keep it off the stack
+
+// The big-value fonts the pages draw through the cache, rasterized by U8g2
+// itself the way OledU8g2::RasterGlyph does (one band: the canvas is 128x64).
+const struct {
+  const uint8_t* font;
+  const char* name;
+} kBigFonts[] = {
+    {u8g2_font_inb33_mn, "inb33"},
+    {u8g2_font_logisoso34_tn, "logisoso34"},
+    {u8g2_font_logisoso32_tn, "logisoso32"},
+    {u8g2_font_logisoso30_tn, "logisoso30"},
+};
+
+U8G2_SSD1306_128X64_NONAME_F_HW_I2C g_canvas(U8G2_R0);
+U8G2_SSD1306_128X32_UNIVISION_F_HW_I2C g_small(U8G2_R0);
+U8G2_SSD1306_128X64_NONAME_F_HW_I2C g_large(U8G2_R0);
+GlyphCache g_big_cache;
+
+int16_t RasterU8g2(void* ctx, const void* font, char ch, uint8_t color, uint8_t* canvas) {
+  U8G2* u8 = static_cast<U8G2*>(ctx);
+  const char s[2] = {ch, '\0'};
+  u8->clearBuffer();
+  u8->setFont(static_cast<const uint8_t*>(font));
+  u8->setDrawColor(color);
+  const int16_t advance =
+      static_cast<int16_t>(u8->drawStr(GlyphCache::kOriginX, GlyphCache::kOriginY, s));
+  memcpy(canvas, u8->getBufferPtr(), GlyphCache::kCanvasPages * GlyphCache::kCanvasW);
+  return advance;
+}
+
+}  // namespace
+
+void test_cached_draw_is_pixel_identical() {
+  TEST_ASSERT_TRUE(g_cache.load(&kTransparentFont, Raster, nullptr));
+  TEST_ASSERT_TRUE(g_cache.load(&kSolidFont, Raster, nullptr));
+  const TestFont* fonts[] = {&kTransparentFont, &kSolidFont};
+  const char* values[] = {"-12.5", "0123456789+", "---"};
+  const uint8_t heights[] = {4, 8};  // 128x32 and 128x64
+  uint8_t expect[128 * 64 / 8];
+  uint8_t actual[128 * 64 / 8];
+  uint32_t cases = 0;
+  for (const TestFont* font : fonts) {
+    for (const char* value : values) {
+      for (uint8_t tiles_h : heights) {
+        for (uint8_t flip = 0; flip < 2; ++flip) {
+          for (uint8_t color = 0; color < 3; ++color) {
+            for (int16_t y = -6; y < tiles_h * 8 + 40; y += 3) {
+              for (int16_t x = -30; x < 140; x += 17) {
+                const size_t len = static_cast<size_t>(tiles_h) * 128;
+                Noise(expect, len, static_cast<uint32_t>(cases));
+                memcpy(actual, expect, len);
+                RefDrawStr(*font, value, expect, 16, tiles_h, x, y, color, flip != 0);
+                TEST_ASSERT_TRUE(g_cache.drawStr(font, value, actual, 16, tiles_h, x, y, color,
+                                                 flip != 0));
+                TEST_ASSERT_EQUAL_MEMORY(expect, actual, len);
+                ++cases;
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+  TEST_ASSERT_TRUE(cases > 1000);
+}
+
+void test_uncached_text_is_left_to_u8g2() {
+  uint8_t frame[128 * 32 / 8] = {};
+  uint8_t before[sizeof(frame)] = {};
+  TEST_ASSERT_TRUE(g_cache.load(&kSolidFont, Raster, nullptr));
+  TEST_ASSERT_FALSE(g_cache.drawStr(&kSolidFont, "12A", frame, 16, 4, 10, 30, 1, false));
+  TEST_ASSERT_EQUAL_MEMORY(before, frame, sizeof(frame));
+  static const TestFont kOtherFont{false};
+  TEST_ASSERT_FALSE(g_cache.drawStr(&kOtherFont, "12", frame, 16, 4, 10, 30, 1, false));
+  TEST_ASSERT_FALSE(g_cache.loaded(&kOtherFont));
+}
+
+// Each cached character is rasterized once into the pool (solid fonts keep a
+// background plane too); reloading and drawing never allocate again.
+void test_pool_holds_each_glyph_once() {
+  static GlyphCache cache;
+  TEST_ASSERT_TRUE(cache.load(&kSolidFont, Raster, nullptr));
+  size_t expect = 0;
+  for (const char* p = "0123456789-+."; *p; ++p) {
+    const GlyphShape g = ShapeFor(*p);
+    expect += 2u * static_cast<size_t>(g.w) * static_cast<size_t>((g.h + 7) / 8);
+  }
+  TEST_ASSERT_EQUAL_UINT32(expect, cache.poolUsed());
+  TEST_ASSERT_TRUE(cache.load(&kSolidFont, Raster, nullptr));
+  uint8_t frame[128 * 32 / 8] = {};
+  for (int i = 0; i < 100; ++i) {
+    TEST_ASSERT_TRUE(cache.drawStr(&kSolidFont, "1234", frame, 16, 4, 20, 38, 1, false));
+  }
+  TEST_ASSERT_EQUAL_UINT32(expect, cache.poolUsed());
+}
+
+// Cached blits against U8g2's own drawStr for the page fonts, on both panel
+// heights, both rotations and all three draw colors over a noisy frame.
+void test_cached_draw_matches_u8g2() {
+  const char* values[] = {"-12.5", "0123456789", "+.-"};
+  U8G2* targets[] = {&g_small, &g_large};
+  uint8_t actual[128 * 64 / 8];
+  uint32_t cases = 0;
+  for (const auto& big : kBigFonts) {
+    const uint8_t* font = big.font;
+    TEST_ASSERT_TRUE(g_big_cache.load(font, RasterU8g2, &g_canvas));
+    for (U8G2* u8 : targets) {
+      const uint8_t tiles_h = u8->getBufferTileHeight();
+      const size_t len = static_cast<size_t>(tiles_h) * 128;
+      for (uint8_t flip = 0; flip < 2; ++flip) {
+        u8->setDisplayRotation(flip ? U8G2_R2 : U8G2_R0);
+        for (uint8_t color = 0; color < 3; ++color) {
+          for (const char* value : values) {
+            for (int16_t y = 36; y < tiles_h * 8 + 12; y += 5) {
+              for (int16_t x = 0; x < 100; x += 13) {
+                Noise(u8->getBufferPtr(), len, cases);
+                memcpy(actual, u8->getBufferPtr(), len);
+                u8->setFont(font);
+                u8->setDrawColor(color);
+                u8->drawStr(x, y, value);
+                TEST_ASSERT_TRUE(g_big_cache.drawStr(font, value, actual, 16, tiles_h, x, y,
+                                                     color, flip != 0));
+                TEST_ASSERT_EQUAL_MEMORY(u8->getBufferPtr(), actual, len);
+                ++cases;
+              }
+            }
+          }
+        }
+      }
+      u8->setDisplayRotation(U8G2_R0);
+    }
+  }
+  TEST_ASSERT_TRUE(cases > 1000);
+}
+
+// Per-frame cost of the big value, U8g2 drawStr vs the cached blit. Reported
+// only: host timings say nothing reliable about the target.
+void test_big_value_benchmark() {
+  constexpr int kFrames = 5000;
+  volatile uint8_t sink = 0;
+  for (const auto& big : kBigFonts) {
+    const uint8_t* font = big.font;
+    TEST_ASSERT_TRUE(g_big_cache.load(font, RasterU8g2, &g_canvas));
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kFrames; ++i) {
+      g_small.clearBuffer();
+      g_small.setFont(font);
+      g_small.setDrawColor(1);
+      g_small.drawStr(20, 36, "-12.5");
+      sink = static_cast<uint8_t>(sink + g_small.getBufferPtr()[i % 512]);
+    }
+    const double u8g2_s =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kFrames; ++i) {
+      g_small.clearBuffer();
+      g_big_cache.drawStr(font, "-12.5", g_small.getBufferPtr(), 16, 4, 20, 36, 1, false);
+      sink = static_cast<uint8_t>(sink + g_small.getBufferPtr()[i % 512]);
+    }
+    const double cached_s =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    printf("[RENDER] big value %-10s u8g2=%.2fus cached=%.2fus per frame\n", big.name,
+           1e6 * u8g2_s / kFrames, 1e6 * cached_s / kFrames);
+  }
+  printf("[RENDER] glyph pool %u bytes\n", static_cast<unsigned>(g_big_cache.poolUsed()));
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_cached_draw_is_pixel_identical);
+  RUN_TEST(test_uncached_text_is_left_to_u8g2);
+  RUN_TEST(test_pool_holds_each_glyph_once);
+  RUN_TEST(test_cached_draw_matches_u8g2);
+  RUN_TEST(test_big_value_benchmark);
+  return UNITY_END();
+}
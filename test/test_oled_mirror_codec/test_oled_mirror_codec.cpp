@@ -0,0 +1,84 @@
+#include <unity.h>
+
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "wifi/oled_mirror_codec.h"
+
+namespace {
+
+std::vector<uint8_t> Encode(const uint8_t* in, size_t n) {
+  std::vector<uint8_t> out;
+  const size_t len = PackBitsEncode(in, n, [&](uint8_t b) { out.push_back(b); });
+  TEST_ASSERT_EQUAL_UINT32(len, out.size());
+  return out;
+}
+
+// Reference decoder (same as the /live page script).
+std::vector<uint8_t> Decode(const std::vector<uint8_t>& in) {
+  std::vector<uint8_t> out;
+  size_t i = 0;
+  while (i < in.size()) {
+    const uint8_t h = in[i++];
+    if (h < 128) {
+      for (uint8_t k = 0; k <= h; ++k) out.push_back(in[i++]);
+    } else if (h > 128) {
+      const uint8_t b = in[i++];
+      for (int k = 0; k < 257 - h; ++k) out.push_back(b);
+    }
+  }
+  return out;
+}
+
+void CheckRoundTrip(const uint8_t* frame, size_t n) {
+  const std::vector<uint8_t> enc = Encode(frame, n);
+  TEST_ASSERT_TRUE(enc.size() <= n + n / 128 + 1);
+  const std::vector<uint8_t> dec = Decode(enc);
+  TEST_ASSERT_EQUAL_UINT32(n, dec.size());
+  TEST_ASSERT_EQUAL_MEMORY(frame, dec.data(), n);
+}
+
+}  // namespace
+
+void test_blank_frame_is_tiny() {
+  uint8_t frame[512] = {};
+  const std::vector<uint8_t> enc = Encode(frame, sizeof(frame));
+  TEST_ASSERT_EQUAL_UINT32(8, enc.size());  // four runs of 128
+  CheckRoundTrip(frame, sizeof(frame));
+}
+
+void test_mixed_frame_round_trips() {
+  uint8_t frame[1024];
+  uint32_t x = 12345;
+  for (size_t i = 0; i < sizeof(frame); ++i) {
+    x = x * 1103515245u + 12345u;
+    // Mostly dark with glyph-like noise and a few short repeats.
+    frame[i] = (i % 97 < 30) ? static_cast<uint8_t>(x >> 24) : ((i % 7 == 0) ? 0x3C : 0);
+  }
+  CheckRoundTrip(frame, sizeof(frame));
+  for (size_t i = 0; i < sizeof(frame); ++i) frame[i] = static_cast<uint8_t>(i * 37);
+  CheckRoundTrip(frame, sizeof(frame));  // incompressible: literal runs only
+  const uint8_t pairs[] = {1, 1, 2, 2, 3, 3, 3, 4};
+  CheckRoundTrip(pairs, sizeof(pairs));
+}
+
+void test_base64_stream() {
+  const char* cases[][2] = {{"", ""}, {"f", "Zg=="}, {"fo", "Zm8="}, {"foo", "Zm9v"},
+                            {"foobar", "Zm9vYmFy"}};
+  for (const auto& c : cases) {
+    std::string out;
+    auto b64 = MakeBase64Stream([&](char ch) { out.push_back(ch); });
+    for (const char* p = c[0]; *p; ++p) b64.put(static_cast<uint8_t>(*p));
+    b64.finish();
+    TEST_ASSERT_EQUAL_STRING(c[1], out.c_str());
+  }
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_blank_frame_is_tiny);
+  RUN_TEST(test_mixed_frame_round_trips);
+  RUN_TEST(test_base64_stream);
+  return UNITY_END();
+}
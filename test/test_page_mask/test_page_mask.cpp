@@ -10,8 +10,32 @@ void test_page_mask_all_basic() {
   TEST_ASSERT_EQUAL_UINT32(0xFFFFFFFFu, PageMaskAll(33));
 }
 
+void test_page_mask_bitset_beyond_32() {
+  PageMask m;
+  TEST_ASSERT_TRUE(m.none());
+  m.set(3);
+  m.set(40);
+  TEST_ASSERT_TRUE(m.test(3));
+  TEST_ASSERT_TRUE(m.test(40));
+  TEST_ASSERT_FALSE(m.test(41));
+  TEST_ASSERT_EQUAL_UINT32(0x8u, m.word(0));
+  TEST_ASSERT_EQUAL_UINT32(0x100u, m.word(1));
+  m.flip(40);
+  TEST_ASSERT_FALSE(m.test(40));
+  m.set(kMaxPages);  // ignored
+  TEST_ASSERT_FALSE(m.test(kMaxPages));
+
+  const PageMask all = PageMask::All(40);
+  TEST_ASSERT_EQUAL_UINT32(0xFFFFFFFFu, all.word(0));
+  TEST_ASSERT_EQUAL_UINT32(0xFFu, all.word(1));
+  TEST_ASSERT_TRUE(all.covers(m));
+  TEST_ASSERT_FALSE(m.covers(all));
+  TEST_ASSERT_TRUE((all & m) == m);
+}
+
 int main() {
   UNITY_BEGIN();
   RUN_TEST(test_page_mask_all_basic);
+  RUN_TEST(test_page_mask_bitset_beyond_32);
   return UNITY_END();
 }
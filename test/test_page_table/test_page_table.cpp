@@ -0,0 +1,108 @@
+#include <unity.h>
+
+#include <string.h>
+
+#include "ui/pages.h"
+
+namespace {
+
+void Put(SignalSnapshot& snap, SignalId id, float value, uint8_t flags = 0) {
+  snap.mask |= SignalBit(id);
+  snap.read[static_cast<size_t>(id)].value = value;
+  snap.read[static_cast<size_t>(id)].valid = true;
+  snap.read[static_cast<size_t>(id)].flags = flags;
+}
+
+}  // namespace
+
+void test_meta_rows_follow_page_ids() {
+  size_t meta_count = 0;
+  const PageMeta* meta = GetPageMeta(meta_count);
+  size_t page_count = 0;
+  const PageDef* pages = GetPageTable(page_count);
+  TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(PageId::kCount), meta_count);
+  TEST_ASSERT_EQUAL_UINT32(meta_count, page_count);
+  for (size_t i = 0; i < meta_count; ++i) {
+    TEST_ASSERT_EQUAL_UINT8(i, static_cast<uint8_t>(meta[i].id));
+    TEST_ASSERT_EQUAL_STRING(pages[i].label, meta[i].label);
+    TEST_ASSERT_NOT_NULL(meta[i].unit);
+    TEST_ASSERT_NOT_NULL(meta[i].unit_imperial);
+    const bool user_sensor = meta[i].render == PageRender::kUserSensor0 ||
+                             meta[i].render == PageRender::kUserSensor1;
+    TEST_ASSERT_TRUE(user_sensor || meta[i].signal < SignalId::kCount);
+    TEST_ASSERT_TRUE(meta[i].render != PageRender::kAfr || meta[i].alt_label != nullptr);
+  }
+}
+
+void test_signal_rows_render_from_table() {
+  AppState state;
+  ScreenSettings cfg;
+  SignalSnapshot snap;
+  Put(snap, SignalId::kClt, 212.0f);
+  Put(snap, SignalId::kVss1, 10.0f);
+
+  cfg.imperial_units = false;
+  PageRenderData d = BuildPageData(PageId::kClt, state, cfg, snap, 1000);
+  TEST_ASSERT_EQUAL_STRING("CLT", d.label);
+  TEST_ASSERT_EQUAL_STRING("100", d.big);
+  TEST_ASSERT_EQUAL_STRING("C", d.unit);
+  TEST_ASSERT_TRUE(d.valid && d.has_canon);
+  d = BuildPageData(PageId::kVss, state, cfg, snap, 1000);
+  TEST_ASSERT_EQUAL_STRING("36.0", d.big);
+  TEST_ASSERT_EQUAL_STRING("km/h", d.unit);
+
+  cfg.imperial_units = true;
+  d = BuildPageData(PageId::kClt, state, cfg, snap, 1000);
+  TEST_ASSERT_EQUAL_STRING("212", d.big);
+  TEST_ASSERT_EQUAL_STRING("F", d.unit);
+
+  Put(snap, SignalId::kTps, 5.0f, kFlagStale);
+  snap.read[static_cast<size_t>(SignalId::kTps)].valid = false;
+  d = BuildPageData(PageId::kTps, state, cfg, snap, 1000);
+  TEST_ASSERT_FALSE(d.valid);
+  TEST_ASSERT_EQUAL_STRING("STAL", d.err_a);
+
+  SignalId src = SignalId::kCount;
+  TEST_ASSERT_TRUE(PageSourceSignal(PageId::kAfrTgt, state, src));
+  TEST_ASSERT_TRUE(src == SignalId::kAfrTarget1);
+}
+
+void test_special_rows() {
+  AppState state;
+  ScreenSettings cfg;
+  cfg.imperial_units = false;
+  SignalSnapshot snap;
+  Put(snap, SignalId::kAfr1, 14.7f);
+  Put(snap, SignalId::kMap, 150.0f);
+
+  PageRenderData d = BuildPageData(PageId::kAfr1, state, cfg, snap, 1000);
+  TEST_ASSERT_EQUAL_STRING("AFR", d.label);
+  TEST_ASSERT_EQUAL_STRING("14.7", d.big);
+  state.afr_show_lambda = true;
+  state.stoich_afr = 14.7f;
+  d = BuildPageData(PageId::kAfr1, state, cfg, snap, 1000);
+  TEST_ASSERT_EQUAL_STRING("LAM", d.label);
+  TEST_ASSERT_EQUAL_STRING("1.00", d.big);
+  TEST_ASSERT_EQUAL_STRING("", d.unit);
+
+  state.baro_acquired = false;
+  d = BuildPageData(PageId::kBoost, state, cfg, snap, 1000);
+  TEST_ASSERT_EQUAL_STRING("50.0", d.big);
+  TEST_ASSERT_EQUAL_STRING("(est)", d.suffix);
+  TEST_ASSERT_FALSE(d.has_canon);
+  d = BuildPageData(PageId::kMapAbs, state, cfg, snap, 1000);
+  TEST_ASSERT_EQUAL_STRING("150", d.big);
+  TEST_ASSERT_EQUAL_STRING("kPa", d.unit);
+
+  strlcpy(state.user_sensor[0].label, "FUEL", sizeof(state.user_sensor[0].label));
+  d = BuildPageData(PageId::kOilP, state, cfg, snap, 1000);
+  TEST_ASSERT_EQUAL_STRING("FUEL", d.label);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_meta_rows_follow_page_ids);
+  RUN_TEST(test_signal_rows_render_from_table);
+  RUN_TEST(test_special_rows);
+  return UNITY_END();
+}
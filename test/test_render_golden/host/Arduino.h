@@ -0,0 +1,50 @@
+#pragma once
+
+// Host stand-in for the Arduino core, limited to what the page renderer and
+// U8g2's Arduino wrappers use (native_render env). GPIO is inert and delays
+// return immediately.
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "Print.h"
+
+#define HIGH 0x1
+#define LOW 0x0
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+#define PROGMEM
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+uint32_t millis();
+uint32_t micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+int digitalRead(uint8_t pin);
+
+// Not in every host libc.
+inline size_t HostStrlcpy(char* dst, const char* src, size_t size) {
+  const size_t len = strlen(src);
+  if (size > 0) {
+    const size_t n = (len < size - 1) ? len : size - 1;
+    memcpy(dst, src, n);
+    dst[n] = '\0';
+  }
+  return len;
+}
+inline size_t HostStrlcat(char* dst, const char* src, size_t size) {
+  const size_t used = strnlen(dst, size);
+  if (used == size) return size + strlen(src);
+  return used + HostStrlcpy(dst + used, src, size - used);
+}
+#define strlcpy HostStrlcpy
+#define strlcat HostStrlcat
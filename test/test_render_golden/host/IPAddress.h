@@ -0,0 +1,13 @@
+#pragma once
+
+// Host stand-in: wifi_portal.h only needs the type name.
+
+#include <stdint.h>
+
+class IPAddress {
+ public:
+  IPAddress() : addr_(0) {}
+
+ private:
+  uint32_t addr_;
+};
@@ -0,0 +1,24 @@
+#pragma once
+
+// Host stand-in for the Arduino Print base class (U8X8/U8G2 derive from it).
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+class Print {
+ public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t* buf, size_t size) {
+    size_t n = 0;
+    while (size--) n += write(*buf++);
+    return n;
+  }
+  size_t write(const char* s) {
+    return s ? write(reinterpret_cast<const uint8_t*>(s), strlen(s)) : 0;
+  }
+  size_t print(const char* s) { return write(s); }
+  size_t print(char c) { return write(static_cast<uint8_t>(c)); }
+  virtual void flush() {}
+};
@@ -0,0 +1,41 @@
+#pragma once
+
+// Host stand-in for the Arduino Wire library: every transfer succeeds and
+// goes nowhere. The golden tests read frames from the U8g2 buffer.
+
+#include <Arduino.h>
+
+class TwoWire {
+ public:
+  bool begin() { return true; }
+  bool begin(int sda, int scl, uint32_t freq = 0) {
+    (void)sda;
+    (void)scl;
+    (void)freq;
+    return true;
+  }
+  void setClock(uint32_t hz) { (void)hz; }
+  void beginTransmission(uint8_t addr) { (void)addr; }
+  void beginTransmission(int addr) { (void)addr; }
+  uint8_t endTransmission(bool stop = true) {
+    (void)stop;
+    return 0;
+  }
+  size_t write(uint8_t b) {
+    (void)b;
+    return 1;
+  }
+  size_t write(const uint8_t* buf, size_t len) {
+    (void)buf;
+    return len;
+  }
+  uint8_t requestFrom(uint8_t addr, uint8_t len) {
+    (void)addr;
+    (void)len;
+    return 0;
+  }
+  int available() { return 0; }
+  int read() { return -1; }
+};
+
+extern TwoWire Wire;
@@ -0,0 +1,22 @@
+#pragma once
+
+// Host stand-in for the FreeRTOS bits the display driver uses. The golden
+// tests are single-threaded: critical sections and locks are no-ops.
+
+#include <stdint.h>
+
+typedef int BaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdTRUE 1
+#define pdFALSE 0
+#define portMAX_DELAY 0xFFFFFFFFu
+#define pdMS_TO_TICKS(ms) (static_cast<TickType_t>(ms))
+
+typedef struct {
+  int unused;
+} portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED {0}
+
+inline void portENTER_CRITICAL(portMUX_TYPE* mux) { (void)mux; }
+inline void portEXIT_CRITICAL(portMUX_TYPE* mux) { (void)mux; }
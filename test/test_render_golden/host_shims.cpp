@@ -0,0 +1,82 @@
+// Host definitions behind the native_render shims (host/), plus inert
+// stand-ins for the firmware modules outside the renderer's build filter.
+#include <Arduino.h>
+#include <Wire.h>
+
+#include <chrono>
+
+#include "app/i2c_oled_log.h"
+#include "ui_menu.h"
+#include "wifi/wifi_portal.h"
+
+namespace {
+
+const std::chrono::steady_clock::time_point g_start = std::chrono::steady_clock::now();
+
+}  // namespace
+
+TwoWire Wire;
+
+uint32_t millis() {
+  return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                                   std::chrono::steady_clock::now() - g_start)
+                                   .count());
+}
+
+uint32_t micros() {
+  return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                                   std::chrono::steady_clock::now() - g_start)
+                                   .count());
+}
+
+void delay(uint32_t ms) { (void)ms; }
+void delayMicroseconds(uint32_t us) { (void)us; }
+void pinMode(uint8_t pin, uint8_t mode) {
+  (void)pin;
+  (void)mode;
+}
+void digitalWrite(uint8_t pin, uint8_t val) {
+  (void)pin;
+  (void)val;
+}
+int digitalRead(uint8_t pin) {
+  (void)pin;
+  return HIGH;  // released bus lines read high
+}
+
+// Menus are not part of the page goldens; AppState only needs the type.
+UiMenu::UiMenu() {}
+bool UiMenu::isActive() const { return false; }
+void UiMenu::render(OledU8g2& display, const ScreenSettings& cfg, ValueKind page_kind,
+                    bool page_units_imperial, bool max_alert_enabled, bool min_alert_enabled,
+                    DisplayTopology display_topology, PhysicalDisplayId disp,
+                    bool display_setup_confirm, const char* page_label, uint8_t page_index,
+                    bool clear_buffer, uint8_t viewport_y, uint8_t viewport_h,
+                    bool send_buffer) const {
+  (void)display;
+  (void)cfg;
+  (void)page_kind;
+  (void)page_units_imperial;
+  (void)max_alert_enabled;
+  (void)min_alert_enabled;
+  (void)display_topology;
+  (void)disp;
+  (void)display_setup_confirm;
+  (void)page_label;
+  (void)page_index;
+  (void)clear_buffer;
+  (void)viewport_y;
+  (void)viewport_h;
+  (void)send_buffer;
+}
+
+const char* WifiPortalPass() { return ""; }
+
+void I2cOledLogEvent(uint8_t oled, I2cOledAction action, bool ok, uint8_t sda_pin,
+                     uint8_t scl_pin) {
+  (void)oled;
+  (void)action;
+  (void)ok;
+  (void)sda_pin;
+  (void)scl_pin;
+}
@@ -0,0 +1,411 @@
+// Host-only golden images for the page renderer (pio test -e native_render).
+// renderUi draws through OledU8g2 and the real U8g2 into in-memory frame
+// buffers for every page in GetPageTable, every configured DisplayTopology,
+// metric and imperial units, and the normal, stale, invalid and alert states.
+// Each case is one PBM contact sheet (a row per page: primary frame, then
+// the secondary frame when the topology uses it; 1 = lit pixel, hardware
+// invert applied) compared pixel-exactly with golden/<case>.pbm.
+// A missing golden fails; RENDER_GOLDEN_UPDATE=1 (re-)records all of them
+// after an intended display change. A mismatch leaves <case>.actual.pbm next
+// to the golden.
+#include <unity.h>
+
+#include <chrono>
+#include <memory>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <sys/stat.h>
+#include <vector>
+
+#include "alerts/alerts_engine.h"
+#include "app_state.h"
+#include "data/datastore.h"
+#include "drivers/oled_u8g2.h"
+#include "ui/pages.h"
+#include "ui_render.h"
+
+#ifndef RENDER_GOLDEN_DIR
+#define RENDER_GOLDEN_DIR "test/test_render_golden/golden"
+#endif
+
+namespace {
+
+constexpr uint32_t kNowMs = 100000;  // even 250 ms blink phase: alert marks on
+constexpr uint8_t kFrameW = 128;
+
+enum class DataState : uint8_t { kNormal, kStale, kInvalid, kAlert };
+
+struct TopologyCase {
+  DisplayTopology topo;
+  const char* name;
+  bool tall_primary;  // 128x64 primary split into two zones
+  bool secondary;
+};
+
+const TopologyCase kTopologies[] = {
+    {DisplayTopology::kSmallOnly, "small", false, false},
+    {DisplayTopology::kDualSmall, "dual", false, true},
+    {DisplayTopology::kLargeOnly, "large", true, false},
+    {DisplayTopology::kLargePlusSmall, "large_small", true, true},
+};
+
+const struct {
+  DataState state;
+  const char* name;
+} kStates[] = {
+    {DataState::kNormal, "normal"},
+    {DataState::kStale, "stale"},
+    {DataState::kInvalid, "invalid"},
+    {DataState::kAlert, "alert"},
+};
+
+// One plausible reading per decoded signal, in contract units.
+const SignalSample kSamples[] = {
+    {SignalId::kMap, 182.4f},       {SignalId::kClt, 195.0f},
+    {SignalId::kRpm, 3450.0f},      {SignalId::kTps, 42.5f},
+    {SignalId::kMat, 88.0f},        {SignalId::kAdv, 24.5f},
+    {SignalId::kPw1, 4.25f},        {SignalId::kPw2, 4.3f},
+    {SignalId::kPwSeq1, 4.1f},      {SignalId::kEgoCor1, 103.2f},
+    {SignalId::kAfr1, 13.2f},       {SignalId::kAfrTarget1, 12.9f},
+    {SignalId::kEgt1, 1450.0f},     {SignalId::kBatt, 13.8f},
+    {SignalId::kKnkRetard, 1.5f},   {SignalId::kSensors1, 352.0f},
+    {SignalId::kSensors2, 205.0f},  {SignalId::kLaunchTiming, 10.0f},
+    {SignalId::kTcRetard, 2.5f},    {SignalId::kVss1, 27.8f},
+};
+constexpr uint8_t kSampleCount = sizeof(kSamples) / sizeof(kSamples[0]);
+
+OledU8g2 g_primary(OledU8g2::Bus::kHw, 0, 0, -1);
+OledU8g2 g_secondary(OledU8g2::Bus::kSw, 0, 0, -1);
+DataStore g_store;
+AlertsEngine g_alerts;
+
+void SetupDisplays(const TopologyCase& tc) {
+  if (tc.tall_primary) {
+    TEST_ASSERT_TRUE(g_primary.begin64(400000));
+  } else {
+    TEST_ASSERT_TRUE(g_primary.begin(400000, OledU8g2::Profile::kUnivision));
+  }
+  TEST_ASSERT_TRUE(g_secondary.begin(100000, OledU8g2::Profile::kUnivision));
+  // Frames stay in memory: an async send only hands the buffer off.
+  g_primary.setAsync(true);
+  g_secondary.setAsync(true);
+}
+
+void SetupState(AppState& state, const TopologyCase& tc, bool imperial, DataState ds) {
+  initDefaults(state);
+  state.display_topology = tc.topo;
+  state.dual_screens = tc.secondary;
+  state.oled_primary_ready = true;
+  state.oled_secondary_ready = tc.secondary;
+  state.can_ready = true;
+  state.can_bitrate_locked = true;
+  state.can_link.state = CanLinkState::kOk;
+  state.can_link.health = CanHealth::kOk;
+  state.can_stats.rx_ok_count = 1000;
+  state.last_can_rx_ms = kNowMs;
+  state.baro_acquired = true;
+  state.baro_kpa = 100.0f;
+  for (uint8_t p = 0; p < kPageCount; ++p) {
+    SetPageUnits(state, p, imperial);
+    if (ds == DataState::kAlert) {
+      state.thresholds[p].max = -1000.0f;  // every valid reading is over
+      SetPageMaxAlertEnabled(state, p, true);
+    }
+  }
+
+  g_store.clear();
+  switch (ds) {
+    case DataState::kNormal:
+    case DataState::kAlert:
+      g_store.updateGroup(kSamples, kSampleCount, kNowMs - 20);
+      break;
+    case DataState::kStale:
+      g_store.restore(kSamples, kSampleCount, kNowMs - 20);
+      break;
+    case DataState::kInvalid:
+      for (uint8_t i = 0; i < kSampleCount; ++i) {
+        g_store.note_invalid(kSamples[i].id, kNowMs - 20);
+      }
+      break;
+  }
+  g_alerts = AlertsEngine();
+  g_alerts.update(state, g_store, kNowMs);
+}
+
+void RenderPage(AppState& state, uint8_t page, size_t page_count) {
+  for (uint8_t z = 0; z < kMaxZones; ++z) {
+    state.page_index[z] = static_cast<uint8_t>((page + z) % page_count);
+    state.force_redraw[z] = true;
+  }
+  renderUi(state, g_store, g_primary, g_secondary, kNowMs, true, true, g_alerts);
+}
+
+// Appends `oled`'s frame as PBM rows (MSB = leftmost pixel).
+void AppendFrame(const OledU8g2& oled, std::vector<uint8_t>& rows) {
+  const uint8_t* fb = oled.frameBuffer();
+  const uint8_t height = oled.height();
+  const uint8_t flip = oled.inverted() ? 1 : 0;
+  for (uint8_t y = 0; y < height; ++y) {
+    for (uint8_t xb = 0; xb < kFrameW / 8; ++xb) {
+      uint8_t packed = 0;
+      for (uint8_t b = 0; b < 8; ++b) {
+        const uint8_t col = fb[(y / 8) * kFrameW + xb * 8 + b];
+        const uint8_t lit = static_cast<uint8_t>(((col >> (y % 8)) & 1u) ^ flip);
+        packed = static_cast<uint8_t>(packed | (lit << (7 - b)));
+      }
+      rows.push_back(packed);
+    }
+  }
+}
+
+std::string Pbm(const std::vector<uint8_t>& rows) {
+  char header[32];
+  snprintf(header, sizeof(header), "P4\n%u %u\n", static_cast<unsigned>(kFrameW),
+           static_cast<unsigned>(rows.size() / (kFrameW / 8)));
+  return std::string(header) + std::string(rows.begin(), rows.end());
+}
+
+bool ReadFile(const std::string& path, std::string& out) {
+  FILE* f = fopen(path.c_str(), "rb");
+  if (!f) return false;
+  char buf[4096];
+  size_t n;
+  out.clear();
+  while ((n = fread(buf, 1, sizeof(buf), f)) > 0) out.append(buf, n);
+  fclose(f);
+  return true;
+}
+
+bool WriteFile(const std::string& path, const std::string& data) {
+  FILE* f = fopen(path.c_str(), "wb");
+  if (!f) return false;
+  const bool ok = fwrite(data.data(), 1, data.size(), f) == data.size();
+  return (fclose(f) == 0) && ok;
+}
+
+uint32_t DiffPixels(const std::string& a, const std::string& b) {
+  if (a.size() != b.size()) return 0xFFFFFFFFu;
+  uint32_t bits = 0;
+  for (size_t i = 0; i < a.size(); ++i) {
+    uint8_t x = static_cast<uint8_t>(a[i] ^ b[i]);
+    for (; x; x = static_cast<uint8_t>(x & (x - 1))) ++bits;
+  }
+  return bits;
+}
+
+}  // namespace
+
+void test_pages_match_golden_frames() {
+  const bool update = getenv("RENDER_GOLDEN_UPDATE") != nullptr;
+  if (update) mkdir(RENDER_GOLDEN_DIR, 0755);
+  size_t page_count = 0;
+  GetPageTable(page_count);
+  TEST_ASSERT_TRUE(page_count > 0);
+  uint32_t missing = 0;
+  uint32_t mismatched = 0;
+  std::unique_ptr<AppState> state(new AppState());
+  for (const TopologyCase& tc : kTopologies) {
+    SetupDisplays(tc);
+    for (uint8_t imperial = 0; imperial < 2; ++imperial) {
+      for (const auto& st : kStates) {
+        SetupState(*state, tc, imperial != 0, st.state);
+        std::vector<uint8_t> rows;
+        for (uint8_t p = 0; p < page_count; ++p) {
+          RenderPage(*state, p, page_count);
+          AppendFrame(g_primary, rows);
+          if (tc.secondary) AppendFrame(g_secondary, rows);
+        }
+        const std::string name =
+            std::string(tc.name) + (imperial ? "_imperial_" : "_metric_") + st.name;
+        const std::string path = std::string(RENDER_GOLDEN_DIR) + "/" + name + ".pbm";
+        const std::string actual = Pbm(rows);
+        if (update) {
+          TEST_ASSERT_TRUE(WriteFile(path, actual));
+          continue;
+        }
+        std::string golden;
+        if (!ReadFile(path, golden)) {
+          printf("[GOLDEN] %s missing (RENDER_GOLDEN_UPDATE=1 records it)\n", path.c_str());
+          ++missing;
+          continue;
+        }
+        if (golden != actual) {
+          const std::string actual_path =
+              std::string(RENDER_GOLDEN_DIR) + "/" + name + ".actual.pbm";
+          WriteFile(actual_path, actual);
+          printf("[GOLDEN] %s differs (%lu pixels), see %s\n", name.c_str(),
+                 static_cast<unsigned long>(DiffPixels(golden, actual)), actual_path.c_str());
+          ++mismatched;
+        }
+      }
+    }
+  }
+  TEST_ASSERT_EQUAL_UINT32(0, missing);
+  TEST_ASSERT_EQUAL_UINT32(0, mismatched);
+}
+
+// A due frame identical to the one on the panel is neither drawn nor sent;
+// a redraw of only the bottom zone of a shared panel keeps the top zone's
+// pixels exactly as a full redraw would.
+void test_unchanged_frames_are_skipped() {
+  size_t page_count = 0;
+  GetPageTable(page_count);
+  std::unique_ptr<AppState> state(new AppState());
+  for (const TopologyCase& tc : kTopologies) {
+    SetupDisplays(tc);
+    SetupState(*state, tc, false, DataState::kNormal);
+    RenderPage(*state, 0, page_count);
+    std::vector<uint8_t> sent;
+    AppendFrame(g_primary, sent);
+    const uint32_t epoch = g_primary.frameEpoch();
+    const uint32_t skipped = g_primary.frameStats().skipped_frames;
+    // Heartbeat due (same blink phase), nothing changed.
+    renderUi(*state, g_store, g_primary, g_secondary, kNowMs + 500, true, true, g_alerts);
+    TEST_ASSERT_EQUAL_UINT32(epoch, g_primary.frameEpoch());
+    TEST_ASSERT_EQUAL_UINT32(skipped + 1, g_primary.frameStats().skipped_frames);
+    if (!tc.tall_primary) continue;
+    state->force_redraw[1] = true;
+    renderUi(*state, g_store, g_primary, g_secondary, kNowMs + 1000, true, true, g_alerts);
+    TEST_ASSERT_EQUAL_UINT32(epoch + 1, g_primary.frameEpoch());
+    std::vector<uint8_t> again;
+    AppendFrame(g_primary, again);
+    TEST_ASSERT_TRUE(sent == again);
+  }
+}
+
+// The skip needs both the same content fingerprint and the same frame
+// epoch: a panel whose contents are no longer known (invalidateShadow) or a
+// changed reading gets a drawn and sent frame.
+void test_epoch_or_content_change_is_sent() {
+  size_t page_count = 0;
+  GetPageTable(page_count);
+  std::unique_ptr<AppState> state(new AppState());
+  for (const TopologyCase& tc : kTopologies) {
+    SetupDisplays(tc);
+    SetupState(*state, tc, false, DataState::kNormal);
+    RenderPage(*state, 0, page_count);
+    std::vector<uint8_t> sent;
+    AppendFrame(g_primary, sent);
+    uint32_t now = kNowMs + 500;
+    g_store.updateGroup(kSamples, kSampleCount, now - 20);  // same readings, kept fresh
+    renderUi(*state, g_store, g_primary, g_secondary, now, true, true, g_alerts);
+    const uint32_t epoch = g_primary.frameEpoch();
+
+    g_primary.invalidateShadow();
+    now += 500;
+    g_store.updateGroup(kSamples, kSampleCount, now - 20);
+    renderUi(*state, g_store, g_primary, g_secondary, now, true, true, g_alerts);
+    TEST_ASSERT_EQUAL_UINT32(epoch + 2, g_primary.frameEpoch());
+    std::vector<uint8_t> again;
+    AppendFrame(g_primary, again);
+    TEST_ASSERT_TRUE(sent == again);
+
+    now += 500;
+    SignalSample moved[kSampleCount];
+    memcpy(moved, kSamples, sizeof(moved));
+    for (SignalSample& s : moved) s.phys += 5.0f;
+    g_store.updateGroup(moved, kSampleCount, now - 20);
+    renderUi(*state, g_store, g_primary, g_secondary, now, true, true, g_alerts);
+    TEST_ASSERT_EQUAL_UINT32(epoch + 3, g_primary.frameEpoch());
+  }
+}
+
+// The max/min reset flash of a zone with a panel to itself is the panel's
+// invert bit (no frame sent); a zone of a shared panel is redrawn inverted.
+void test_max_blink_flash() {
+  size_t page_count = 0;
+  GetPageTable(page_count);
+  std::unique_ptr<AppState> state(new AppState());
+  for (const TopologyCase& tc : {kTopologies[0], kTopologies[2]}) {
+    SetupDisplays(tc);
+    SetupState(*state, tc, false, DataState::kNormal);
+    RenderPage(*state, 0, page_count);
+    const uint8_t zone = tc.tall_primary ? 1 : 0;
+    state->max_blink_until_ms[zone] = kNowMs + 700;
+    state->max_blink_page[zone] = state->page_index[zone];
+    const uint32_t epoch = g_primary.frameEpoch();
+    // 120 ms phases: on at kNowMs + 240, off at kNowMs + 360.
+    renderUi(*state, g_store, g_primary, g_secondary, kNowMs + 240, true, true, g_alerts);
+    if (tc.tall_primary) {
+      TEST_ASSERT_FALSE(g_primary.inverted());
+      TEST_ASSERT_EQUAL_UINT32(epoch + 1, g_primary.frameEpoch());
+      continue;
+    }
+    TEST_ASSERT_TRUE(g_primary.inverted());
+    renderUi(*state, g_store, g_primary, g_secondary, kNowMs + 360, true, true, g_alerts);
+    TEST_ASSERT_FALSE(g_primary.inverted());
+    TEST_ASSERT_EQUAL_UINT32(epoch, g_primary.frameEpoch());
+  }
+}
+
+// Panel invert = alert invert XOR reset flash; (re)initialization clears
+// both, so a flash cut short by a re-init cannot flip a later alert back.
+void test_flash_xors_panel_invert() {
+  OledU8g2 oled(OledU8g2::Bus::kHw, 0, 0, -1);
+  TEST_ASSERT_TRUE(oled.begin(400000, OledU8g2::Profile::kUnivision));
+  TEST_ASSERT_FALSE(oled.inverted());
+  oled.setInvert(true);
+  TEST_ASSERT_TRUE(oled.inverted());
+  oled.setFlash(true);  // flash over an inverted alert panel shows normal
+  TEST_ASSERT_FALSE(oled.inverted());
+  oled.setFlash(false);
+  TEST_ASSERT_TRUE(oled.inverted());
+  oled.setInvert(false);
+  oled.setFlash(true);
+  TEST_ASSERT_TRUE(oled.inverted());
+
+  TEST_ASSERT_TRUE(oled.begin(400000, OledU8g2::Profile::kUnivision));
+  TEST_ASSERT_FALSE(oled.inverted());
+  oled.setInvert(true);
+  TEST_ASSERT_TRUE(oled.inverted());
+  oled.setFlash(true);
+  TEST_ASSERT_TRUE(oled.begin64(400000));
+  oled.setInvert(true);
+  TEST_ASSERT_TRUE(oled.inverted());
+}
+
+// Wall time of one forced renderUi per page (host CPU, caches warm), per
+// topology with metric units and live data.
+void test_page_render_benchmark() {
+  constexpr int kReps = 200;
+  size_t page_count = 0;
+  const PageDef* pages = GetPageTable(page_count);
+  std::unique_ptr<AppState> state(new AppState());
+  constexpr size_t kTopoCount = sizeof(kTopologies) / sizeof(kTopologies[0]);
+  std::vector<double> us(page_count * kTopoCount, 0.0);
+  for (size_t t = 0; t < kTopoCount; ++t) {
+    SetupDisplays(kTopologies[t]);
+    SetupState(*state, kTopologies[t], false, DataState::kNormal);
+    for (uint8_t p = 0; p < page_count; ++p) {
+      RenderPage(*state, p, page_count);  // warm glyph and metric caches
+      const auto start = std::chrono::steady_clock::now();
+      for (int i = 0; i < kReps; ++i) RenderPage(*state, p, page_count);
+      us[p * kTopoCount + t] =
+          std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start)
+              .count() /
+          kReps;
+    }
+  }
+  printf("[RENDER] us/frame   ");
+  for (const TopologyCase& tc : kTopologies) printf(" %11s", tc.name);
+  printf("\n");
+  for (uint8_t p = 0; p < page_count; ++p) {
+    printf("[RENDER] %-10s ", pages[p].label);
+    for (size_t t = 0; t < kTopoCount; ++t) printf(" %11.1f", us[p * kTopoCount + t]);
+    printf("\n");
+  }
+  TEST_ASSERT_TRUE(us[0] > 0.0);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_pages_match_golden_frames);
+  RUN_TEST(test_unchanged_frames_are_skipped);
+  RUN_TEST(test_epoch_or_content_change_is_sent);
+  RUN_TEST(test_max_blink_flash);
+  RUN_TEST(test_flash_xors_panel_invert);
+  RUN_TEST(test_page_render_benchmark);
+  return UNITY_END();
+}
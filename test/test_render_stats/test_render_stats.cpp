@@ -0,0 +1,52 @@
+#include <unity.h>
+
+#include "ui/render_stats.h"
+
+void test_timing_only_while_read() {
+  RenderStats s;
+  s.tick(1000);
+  TEST_ASSERT_FALSE(s.timing());
+  s.zone(0, 1000);
+  TEST_ASSERT_TRUE(s.timing());
+  s.tick(1000 + RenderStats::kArmMs - 1);
+  TEST_ASSERT_TRUE(s.timing());
+  s.tick(1000 + RenderStats::kArmMs);
+  TEST_ASSERT_FALSE(s.timing());
+}
+
+void test_window_publishes_min_avg_max() {
+  RenderStats s;
+  s.tick(0);
+  s.record(2, RenderStats::kDraw, 300);
+  s.record(2, RenderStats::kDraw, 100);
+  s.record(2, RenderStats::kDraw, 500);
+  s.countFrame(2);
+  s.countSkipInterval(2);
+  s.countSkipUnchanged(2);
+  s.countSkipUnchanged(2);
+  s.countFrame(7);  // out of range: ignored
+  // Nothing published until the window is over.
+  s.tick(RenderStats::kWindowMs - 1);
+  TEST_ASSERT_EQUAL_UINT16(0, s.zone(2, 0).frames);
+  s.tick(RenderStats::kWindowMs + 10);
+  TEST_ASSERT_EQUAL_UINT32(RenderStats::kWindowMs + 10, s.windowMs());
+  const RenderStats::Zone& z = s.zone(2, 0);
+  TEST_ASSERT_EQUAL_UINT32(100, z.stage[RenderStats::kDraw].min_us);
+  TEST_ASSERT_EQUAL_UINT32(300, z.stage[RenderStats::kDraw].avgUs());
+  TEST_ASSERT_EQUAL_UINT32(500, z.stage[RenderStats::kDraw].max_us);
+  TEST_ASSERT_EQUAL_UINT16(0, z.stage[RenderStats::kBuild].samples);
+  TEST_ASSERT_EQUAL_UINT16(1, z.frames);
+  TEST_ASSERT_EQUAL_UINT16(1, z.skipped_interval);
+  TEST_ASSERT_EQUAL_UINT16(2, z.skipped_unchanged);
+  // The next window starts empty.
+  s.tick(2 * RenderStats::kWindowMs + 20);
+  TEST_ASSERT_EQUAL_UINT16(0, s.zone(2, 0).frames);
+  TEST_ASSERT_EQUAL_UINT16(0, s.zone(2, 0).stage[RenderStats::kDraw].samples);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_timing_only_while_read);
+  RUN_TEST(test_window_publishes_min_avg_max);
+  return UNITY_END();
+}
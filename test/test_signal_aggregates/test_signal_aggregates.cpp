@@ -0,0 +1,60 @@
+#include <unity.h>
+
+#include "data/datastore.h"
+#include "data/signal_aggregates.h"
+
+void test_extrema_follow_updates_and_reset() {
+  SignalAggregates agg;
+  DataStore ds;
+  ds.attachAggregates(&agg);
+  ds.update(SignalId::kRpm, 900.0f, 10);
+  ds.update(SignalId::kRpm, 6500.0f, 20);
+  ds.update(SignalId::kRpm, 3000.0f, 30);
+
+  SignalExtrema ext[static_cast<size_t>(SignalId::kCount)];
+  TEST_ASSERT_TRUE(ds.readExtrema(ext, static_cast<size_t>(SignalId::kCount)));
+  const SignalExtrema& rpm = ext[static_cast<size_t>(SignalId::kRpm)];
+  TEST_ASSERT_TRUE(rpm.has_min && rpm.has_max);
+  TEST_ASSERT_EQUAL_FLOAT(900.0f, rpm.min);
+  TEST_ASSERT_EQUAL_FLOAT(6500.0f, rpm.max);
+  TEST_ASSERT_FALSE(ext[static_cast<size_t>(SignalId::kClt)].has_max);
+
+  const uint16_t gen = rpm.gen;
+  ds.requestExtremaReset(false, true);
+  ds.readExtrema(ext, static_cast<size_t>(SignalId::kCount));
+  TEST_ASSERT_FALSE(ext[static_cast<size_t>(SignalId::kRpm)].has_max);
+  TEST_ASSERT_TRUE(ext[static_cast<size_t>(SignalId::kRpm)].has_min);
+  ds.update(SignalId::kRpm, 2000.0f, 40);
+  ds.readExtrema(ext, static_cast<size_t>(SignalId::kCount));
+  TEST_ASSERT_TRUE(ext[static_cast<size_t>(SignalId::kRpm)].gen != gen);
+  TEST_ASSERT_EQUAL_FLOAT(2000.0f, ext[static_cast<size_t>(SignalId::kRpm)].max);
+  TEST_ASSERT_EQUAL_FLOAT(900.0f, ext[static_cast<size_t>(SignalId::kRpm)].min);
+}
+
+void test_window_slides() {
+  SignalAggregates agg;
+  TEST_ASSERT_TRUE(agg.trackWindow(SignalId::kMap, 1600, 0.5f));
+  DataStore ds;
+  ds.attachAggregates(&agg);
+  ds.update(SignalId::kMap, 250.0f, 1000);  // peak, ages out later
+  WindowStats w{};
+  TEST_ASSERT_TRUE(ds.readWindow(SignalId::kMap, 1000, w));
+  TEST_ASSERT_EQUAL_FLOAT(250.0f, w.max);
+  for (uint32_t t = 1100; t <= 3000; t += 100) {
+    ds.update(SignalId::kMap, 100.0f + static_cast<float>(t % 300) / 10.0f, t);
+  }
+  TEST_ASSERT_TRUE(ds.readWindow(SignalId::kMap, 3000, w));
+  TEST_ASSERT_TRUE(w.valid);
+  TEST_ASSERT_TRUE(w.max < 250.0f);
+  TEST_ASSERT_TRUE(w.max >= 120.0f);
+  TEST_ASSERT_TRUE(w.min >= 100.0f);
+  TEST_ASSERT_EQUAL_UINT32(21, w.count);
+  TEST_ASSERT_FALSE(ds.readWindow(SignalId::kRpm, 3000, w));
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_extrema_follow_updates_and_reset);
+  RUN_TEST(test_window_slides);
+  return UNITY_END();
+}
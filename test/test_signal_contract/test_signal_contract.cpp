@@ -0,0 +1,62 @@
+#include <unity.h>
+#include <cmath>
+#include "data/datastore.h"
+#include "data/signal_contract.h"
+#include "data/signal_registry.h"
+
+struct Sample {
+  SignalId id;
+  float phys;
+};
+
+void test_lookup_is_dense() {
+  for (size_t i = 0; i < kSignalCount; ++i) {
+    const SignalContractEntry* e = LookupSignalContract(static_cast<SignalId>(i));
+    TEST_ASSERT_NOT_NULL(e);
+    TEST_ASSERT_EQUAL_UINT8(i, static_cast<uint8_t>(e->id));
+    TEST_ASSERT_EQUAL_FLOAT(e->min, DefaultSignalLimits()[i].min);
+    TEST_ASSERT_EQUAL_FLOAT(e->max, DefaultSignalLimits()[i].max);
+  }
+  TEST_ASSERT_NULL(LookupSignalContract(SignalId::kCount));
+}
+
+void test_reject_mask_bounds() {
+  const Sample batch[] = {
+      {SignalId::kBatt, 6.0f},    // inclusive min
+      {SignalId::kBatt, 18.6f},   // above max
+      {SignalId::kMap, -0.1f},    // below min
+      {SignalId::kRpm, NAN},      // NaN rejected
+      {SignalId::kSensors1, 1234.0f},
+      {SignalId::kCount, 1e9f},   // unknown id ignored
+  };
+  const uint32_t mask = SignalRejectMask(DefaultSignalLimits(), kSignalCount, batch, 6);
+  TEST_ASSERT_EQUAL_HEX32(0x0000000E, mask);
+}
+
+void test_registry_override_and_declare() {
+  SignalRegistry& reg = SignalRegistry::instance();
+  reg.reset();
+  TEST_ASSERT_TRUE(reg.overrideLimits(SignalId::kBatt, 6.0f, 30.0f));
+  static const SignalChannelDesc kBoost2 = {"Boost2", "kPa", 0.0f, 300.0f};
+  const SignalId extra = reg.declare(kBoost2);
+  TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>(SignalId::kCount),
+                          static_cast<uint8_t>(extra));
+  TEST_ASSERT_EQUAL_STRING("Boost2", reg.name(extra));
+  const Sample batch[] = {{SignalId::kBatt, 24.0f}, {extra, 350.0f}};
+  TEST_ASSERT_EQUAL_HEX32(0x2, SignalRejectMask(reg.limits(), reg.count(), batch, 2));
+
+  DataStore ds;
+  TEST_ASSERT_EQUAL_UINT32(reg.count(), ds.size());
+  ds.update(extra, 120.0f, 100);
+  TEST_ASSERT_EQUAL_FLOAT(120.0f, ds.get(extra, 150).value);
+  reg.reset();
+  TEST_ASSERT_EQUAL_UINT32(kSignalCount, reg.count());
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_lookup_is_dense);
+  RUN_TEST(test_reject_mask_bounds);
+  RUN_TEST(test_registry_override_and_declare);
+  return UNITY_END();
+}
@@ -0,0 +1,69 @@
+#include <unity.h>
+
+#include "data/datastore.h"
+#include "data/signal_filter.h"
+
+namespace {
+
+SignalFilterCfg Cfg(FilterKind kind, uint16_t param) {
+  SignalFilterCfg c;
+  c.kind = kind;
+  c.param = param;
+  return c;
+}
+
+void ConfigureOne(SignalFilters& f, SignalId id, SignalFilterCfg cfg) {
+  SignalFilterCfg table[static_cast<size_t>(SignalId::kCount)];
+  table[static_cast<size_t>(id)] = cfg;
+  f.configure(table, static_cast<size_t>(SignalId::kCount));
+}
+
+}  // namespace
+
+void test_ema_time_constant() {
+  SignalFilters f;
+  ConfigureOne(f, SignalId::kMap, Cfg(FilterKind::kEma, 100));
+  TEST_ASSERT_EQUAL_FLOAT(100.0f, f.apply(SignalId::kMap, 100.0f, 1000));
+  // dt == tau: alpha = 0.5.
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 150.0f, f.apply(SignalId::kMap, 200.0f, 1100));
+  // Unfiltered signals pass straight through.
+  TEST_ASSERT_EQUAL_FLOAT(7.0f, f.apply(SignalId::kRpm, 7.0f, 1100));
+}
+
+void test_median_drops_spike() {
+  SignalFilters f;
+  ConfigureOne(f, SignalId::kAfr1, Cfg(FilterKind::kMedian3, 0));
+  f.apply(SignalId::kAfr1, 14.0f, 10);
+  f.apply(SignalId::kAfr1, 14.2f, 20);
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 14.2f, f.apply(SignalId::kAfr1, 25.0f, 30));
+}
+
+void test_rate_limit_and_raw_read() {
+  DataStore ds;
+  SignalFilters f;
+  ds.attachFilters(&f);
+  ConfigureOne(f, SignalId::kSensors1, Cfg(FilterKind::kRateLimit, 10));
+  ds.update(SignalId::kSensors1, 50.0f, 1000);
+  ds.update(SignalId::kSensors1, 80.0f, 1500);  // 10/s over 500 ms -> +5
+  const SignalRead r = ds.get(SignalId::kSensors1, 1500);
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 55.0f, r.value);
+  TEST_ASSERT_EQUAL_FLOAT(80.0f, r.raw);
+}
+
+void test_reconfigure_restarts_state() {
+  SignalFilters f;
+  ConfigureOne(f, SignalId::kMap, Cfg(FilterKind::kEma, 1000));
+  f.apply(SignalId::kMap, 0.0f, 0);
+  ConfigureOne(f, SignalId::kMap, Cfg(FilterKind::kNone, 0));
+  TEST_ASSERT_EQUAL_FLOAT(300.0f, f.apply(SignalId::kMap, 300.0f, 10));
+  TEST_ASSERT_EQUAL_UINT32(0, SanitizeFilterCfg(Cfg(static_cast<FilterKind>(9), 5)).param);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_ema_time_constant);
+  RUN_TEST(test_median_drops_spike);
+  RUN_TEST(test_rate_limit_and_raw_read);
+  RUN_TEST(test_reconfigure_restarts_state);
+  return UNITY_END();
+}
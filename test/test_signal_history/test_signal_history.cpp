@@ -0,0 +1,53 @@
+#include <unity.h>
+
+#include "data/datastore.h"
+#include "data/signal_history.h"
+
+void test_history_newest_first_with_timestamps() {
+  SignalHistory hist;
+  TEST_ASSERT_TRUE(hist.track(SignalId::kMap, 4, 0.1f));
+  DataStore ds;
+  ds.attachHistory(&hist);
+  ds.update(SignalId::kMap, 100.0f, 1000);
+  ds.update(SignalId::kMap, 101.5f, 1020);
+  ds.update(SignalId::kMap, 99.9f, 1100);
+
+  HistoryView view;
+  TEST_ASSERT_TRUE(ds.readHistory(SignalId::kMap, view));
+  TEST_ASSERT_EQUAL_UINT8(3, view.size());
+  const uint32_t ts[3] = {1100, 1020, 1000};
+  const float val[3] = {99.9f, 101.5f, 100.0f};
+  uint8_t i = 0;
+  for (const HistorySample& s : view) {
+    TEST_ASSERT_EQUAL_UINT32(ts[i], s.ts_ms);
+    TEST_ASSERT_FLOAT_WITHIN(0.05f, val[i], s.value);
+    ++i;
+  }
+  TEST_ASSERT_EQUAL_UINT8(3, i);
+  TEST_ASSERT_FALSE(ds.readHistory(SignalId::kRpm, view));
+}
+
+void test_history_wraps_and_respects_budget() {
+  SignalHistory hist;
+  TEST_ASSERT_TRUE(hist.track(SignalId::kRpm, 2, 1.0f));
+  TEST_ASSERT_FALSE(hist.track(SignalId::kRpm, 2, 1.0f));
+  TEST_ASSERT_FALSE(hist.track(SignalId::kClt, HistoryView::kMaxSamples + 1, 1.0f));
+  hist.record(SignalId::kRpm, 800.0f, 10);
+  hist.record(SignalId::kRpm, 900.0f, 20);
+  hist.record(SignalId::kRpm, 1000.0f, 70000);
+  HistoryView view;
+  TEST_ASSERT_TRUE(hist.copy(SignalId::kRpm, view));
+  TEST_ASSERT_EQUAL_UINT8(2, view.size());
+  HistoryView::Iterator it = view.begin();
+  TEST_ASSERT_EQUAL_FLOAT(1000.0f, it->value);
+  ++it;
+  TEST_ASSERT_EQUAL_FLOAT(900.0f, it->value);
+  TEST_ASSERT_EQUAL_UINT32(70000 - 0xFFFF, it->ts_ms);  // delta saturates
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_history_newest_first_with_timestamps);
+  RUN_TEST(test_history_wraps_and_respects_budget);
+  return UNITY_END();
+}
@@ -0,0 +1,125 @@
+#include <unity.h>
+
+#include <stdio.h>
+#include <string.h>
+
+#include "drivers/text_metrics.h"
+
+namespace {
+
+// Synthetic font with U8g2's getStrWidth rule: advances of every glyph but
+// the last, plus the last glyph's ink extent (x offset + bbox width).
+struct TestFont {
+  bool proportional;
+};
+
+constexpr TestFont kMonoFont{false};
+constexpr TestFont kPropFont{true};
+
+uint32_t g_measure_calls = 0;
+
+void GlyphMetrics(const TestFont& font, char ch, int16_t& advance, int16_t& ink) {
+  if (ch == '.') {
+    advance = 6;
+    ink = 4;
+    return;
+  }
+  if (ch == ' ') {
+    advance = 8;
+    ink = 0;  // no ink: U8g2 keeps the plain advance for a blank last glyph
+    return;
+  }
+  const int16_t i = static_cast<int16_t>(static_cast<uint8_t>(ch) % 7);
+  advance = font.proportional ? static_cast<int16_t>(18 + i) : 22;
+  ink = font.proportional ? static_cast<int16_t>(15 + i % 3) : 19;
+}
+
+uint16_t Measure(void*, const void* font, const char* s) {
+  ++g_measure_calls;
+  const TestFont& f = *static_cast<const TestFont*>(font);
+  int16_t w = 0;
+  for (const char* p = s; *p; ++p) {
+    int16_t advance = 0;
+    int16_t ink = 0;
+    GlyphMetrics(f, *p, advance, ink);
+    w = static_cast<int16_t>(w + ((p[1] || ink == 0) ? advance : ink));
+  }
+  return static_cast<uint16_t>(w);
+}
+
+void RandomValue(uint32_t& seed, char* out, size_t len) {
+  static const char kChars[] = "0123456789-+.";
+  for (size_t i = 0; i + 1 < len; ++i) {
+    seed = seed * 1103515245u + 12345u;
+    out[i] = kChars[(seed >> 16) % 13];
+  }
+  out[len - 1] = '\0';
+}
+
+}  // namespace
+
+void test_arithmetic_width_matches_measure() {
+  TextMetrics tm;
+  tm.load(&kMonoFont, 30, -2, Measure, nullptr);
+  tm.load(&kPropFont, 32, -1, Measure, nullptr);
+  TEST_ASSERT_TRUE(tm.uniformDigits(&kMonoFont));
+  TEST_ASSERT_FALSE(tm.uniformDigits(&kPropFont));
+  uint32_t seed = 7;
+  char value[9];
+  for (int i = 0; i < 2000; ++i) {
+    RandomValue(seed, value, 1 + (i % 8) + 1);
+    const TestFont* font = (i & 1) ? &kPropFont : &kMonoFont;
+    const uint32_t before = g_measure_calls;
+    const uint16_t w = tm.width(font, value, Measure, nullptr);
+    TEST_ASSERT_EQUAL_UINT32(before, g_measure_calls);
+    TEST_ASSERT_EQUAL_UINT16(Measure(nullptr, font, value), w);
+  }
+  int16_t ascent = 0;
+  int16_t descent = 0;
+  TEST_ASSERT_TRUE(tm.height(&kPropFont, ascent, descent));
+  TEST_ASSERT_EQUAL_INT16(32, ascent);
+  TEST_ASSERT_EQUAL_INT16(-1, descent);
+}
+
+void test_other_text_is_memoized() {
+  TextMetrics tm;
+  tm.load(&kMonoFont, 30, -2, Measure, nullptr);
+  const uint32_t before = g_measure_calls;
+  TEST_ASSERT_EQUAL_UINT16(Measure(nullptr, &kMonoFont, "STAL"),
+                           tm.width(&kMonoFont, "STAL", Measure, nullptr));
+  TEST_ASSERT_EQUAL_UINT16(Measure(nullptr, &kMonoFont, "1 2"),
+                           tm.width(&kMonoFont, "1 2", Measure, nullptr));
+  const uint32_t after_first = g_measure_calls;
+  TEST_ASSERT_EQUAL_UINT32(before + 4, after_first);
+  for (int i = 0; i < 10; ++i) {
+    tm.width(&kMonoFont, "STAL", Measure, nullptr);
+    tm.width(&kMonoFont, "1 2", Measure, nullptr);
+  }
+  TEST_ASSERT_EQUAL_UINT32(after_first, g_measure_calls);
+  TEST_ASSERT_EQUAL_UINT32(20, tm.memoHits());
+  // Same text, unknown font: measured, not confused with the memo entry.
+  TEST_ASSERT_EQUAL_UINT16(Measure(nullptr, &kPropFont, "STAL"),
+                           tm.width(&kPropFont, "STAL", Measure, nullptr));
+  TEST_ASSERT_EQUAL_UINT16(0, tm.width(&kMonoFont, "", Measure, nullptr));
+}
+
+void test_value_shape() {
+  char shape[8];
+  char other[8];
+  TEST_ASSERT_TRUE(ValueShape("-12.5", shape, sizeof(shape)));
+  TEST_ASSERT_EQUAL_STRING("-00.0", shape);
+  TEST_ASSERT_TRUE(ValueShape("-97.3", other, sizeof(other)));
+  TEST_ASSERT_EQUAL_STRING(shape, other);
+  TEST_ASSERT_TRUE(ValueShape("100.0", other, sizeof(other)));
+  TEST_ASSERT_TRUE(strcmp(shape, other) != 0);
+  TEST_ASSERT_TRUE(ValueShape("1234567", shape, sizeof(shape)));
+  TEST_ASSERT_FALSE(ValueShape("12345678", shape, sizeof(shape)));
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_arithmetic_width_matches_measure);
+  RUN_TEST(test_other_text_is_memoized);
+  RUN_TEST(test_value_shape);
+  return UNITY_END();
+}
@@ -0,0 +1,64 @@
+#include <unity.h>
+
+#include <string.h>
+
+#include "drivers/tile_diff.h"
+
+namespace {
+
+constexpr uint8_t kTilesW = 16;
+constexpr uint8_t kTilesH = 4;  // 128x32
+constexpr size_t kFrameBytes = kTilesW * kTilesH * 8;
+
+void Touch(uint8_t* frame, uint8_t tx, uint8_t ty) {
+  frame[(ty * kTilesW + tx) * 8 + 3] ^= 0x10;
+}
+
+}  // namespace
+
+void test_identical_frames_have_no_runs() {
+  uint8_t frame[kFrameBytes];
+  uint8_t shadow[kFrameBytes];
+  memset(frame, 0xA5, sizeof(frame));
+  memcpy(shadow, frame, sizeof(shadow));
+  TileRun runs[8];
+  uint8_t count = 0xFF;
+  uint16_t changed = 0xFFFF;
+  TEST_ASSERT_TRUE(FindChangedTileRuns(frame, shadow, kTilesW, kTilesH, runs, 8, count, changed));
+  TEST_ASSERT_EQUAL_UINT8(0, count);
+  TEST_ASSERT_EQUAL_UINT16(0, changed);
+}
+
+void test_changed_tiles_group_into_row_runs() {
+  uint8_t frame[kFrameBytes] = {};
+  uint8_t shadow[kFrameBytes] = {};
+  // A two-digit change spanning tiles 5..7 on rows 1 and 2, plus a marker
+  // in the last tile of row 3.
+  for (uint8_t ty = 1; ty <= 2; ++ty) {
+    for (uint8_t tx = 5; tx <= 7; ++tx) Touch(frame, tx, ty);
+  }
+  Touch(frame, 15, 3);
+  TileRun runs[8];
+  uint8_t count = 0;
+  uint16_t changed = 0;
+  TEST_ASSERT_TRUE(FindChangedTileRuns(frame, shadow, kTilesW, kTilesH, runs, 8, count, changed));
+  TEST_ASSERT_EQUAL_UINT8(3, count);
+  TEST_ASSERT_EQUAL_UINT16(7, changed);
+  TEST_ASSERT_EQUAL_UINT8(5, runs[0].x);
+  TEST_ASSERT_EQUAL_UINT8(1, runs[0].y);
+  TEST_ASSERT_EQUAL_UINT8(3, runs[0].w);
+  TEST_ASSERT_EQUAL_UINT8(2, runs[1].y);
+  TEST_ASSERT_EQUAL_UINT8(15, runs[2].x);
+  TEST_ASSERT_EQUAL_UINT8(3, runs[2].y);
+  TEST_ASSERT_EQUAL_UINT8(1, runs[2].w);
+
+  // Too fragmented for the run budget: caller falls back to a full send.
+  TEST_ASSERT_FALSE(FindChangedTileRuns(frame, shadow, kTilesW, kTilesH, runs, 2, count, changed));
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_identical_frames_have_no_runs);
+  RUN_TEST(test_changed_tiles_group_into_row_runs);
+  return UNITY_END();
+}